@@ -1,115 +1,150 @@
 #ifndef ARRAY_H
 #define ARRAY_H
-#include <algorithm>
+#include <cstddef>
 #include <stdexcept>
 namespace s21 {
-template <class T>
-class ArrayIterator;
-
-template <class T>
-class ArrayConstIterator;
-
-template <class T>
+// Fixed-size array with inline storage. Array is an aggregate, so it is
+// initialized like a C array (Array<int, 3> a = {1, 2, 3}) and has the same
+// size and layout as T[N]. A larger Alignment (e.g. 32 or 64 for SIMD
+// loads) over-aligns the storage.
+template <class T, std::size_t N, std::size_t Alignment = alignof(T)>
 class Array {
+  static_assert(Alignment >= alignof(T) && !(Alignment & (Alignment - 1)),
+                "Alignment must be a power of two no less than alignof(T)");
+
  public:
   using value_type = T;
-  using size_type = size_t;
+  using size_type = std::size_t;
   using reference = T&;
   using const_reference = const T&;
   using iterator = T*;
   using const_iterator = const T*;
 
- private:
-  T* data;
-  size_type size_;
-
- public:
-  // Конструкторы, деструктор и оператор присваивания
-  Array() : data(nullptr), size_(0) {}
+  // Public only so that Array stays an aggregate; use the accessors.
+  alignas(Alignment) value_type data_[N > 0 ? N : 1];
 
-  Array(std::initializer_list<value_type> const& items) : size_(items.size()) {
-    data = new T[size_];
-    std::copy(items.begin(), items.end(), data);
+  // Array Element access
+  constexpr reference at(size_type pos) {
+    if (pos >= N) throw std::out_of_range("Index out of range");
+    return data_[pos];
   }
 
-  Array(size_type size) : size_(size) { data = new T[size_]; }
-
-  Array(const Array& other) : size_(other.size_) {
-    data = new T[size_];
-    std::copy(other.begin(), other.end(), data);
+  constexpr const_reference at(size_type pos) const {
+    if (pos >= N) throw std::out_of_range("Index out of range");
+    return data_[pos];
   }
 
-  Array& operator=(const Array& other) {
-    if (this == &other) return *this;
+  constexpr reference operator[](size_type pos) { return data_[pos]; }
 
-    delete[] data;
-    size_ = other.size_;
-    data = new T[size_];
-    std::copy(other.begin(), other.end(), data);
-    return *this;
+  constexpr const_reference operator[](size_type pos) const {
+    return data_[pos];
   }
 
-  ~Array() { delete[] data; }
-
-  // Array Element access
-  reference at(size_type pos) {
-    if (pos >= size_) throw std::out_of_range("Index out of range");
-    return data[pos];
+  constexpr reference front() {
+    if (empty()) throw std::out_of_range("Array is empty");
+    return data_[0];
   }
 
-  reference operator[](size_type pos) { return data[pos]; }
-
-  const_reference operator[](size_type pos) const { return data[pos]; }
+  constexpr const_reference front() const {
+    if (empty()) throw std::out_of_range("Array is empty");
+    return data_[0];
+  }
 
-  const_reference front() const {
+  constexpr reference back() {
     if (empty()) throw std::out_of_range("Array is empty");
-    return data[0];
+    return data_[N - 1];
   }
 
-  const_reference back() const {
+  constexpr const_reference back() const {
     if (empty()) throw std::out_of_range("Array is empty");
-    return data[size_ - 1];
+    return data_[N - 1];
   }
 
-  iterator data_ptr() { return data; }
+  constexpr iterator data() { return data_; }
+
+  constexpr const_iterator data() const { return data_; }
+
+  constexpr iterator data_ptr() { return data_; }
+
+  constexpr const_iterator data_ptr() const { return data_; }
 
   // Array Iterators
-  iterator begin() { return data; }
+  constexpr iterator begin() { return data_; }
 
-  iterator end() { return data + size_; }
+  constexpr iterator end() { return data_ + N; }
 
-  const_iterator begin() const { return data; }
+  constexpr const_iterator begin() const { return data_; }
 
-  const_iterator end() const { return data + size_; }
+  constexpr const_iterator end() const { return data_ + N; }
 
   // Array Capacity
-  bool empty() const { return size_ == 0; }
+  constexpr bool empty() const { return N == 0; }
 
-  size_type size() const { return size_; }
+  constexpr size_type size() const { return N; }
 
-  size_type max_size() const { return static_cast<size_type>(-1) / sizeof(T); }
+  constexpr size_type max_size() const { return N; }
 
   // Array Modifiers
-  void swap(Array& other) {
-    std::swap(data, other.data);
-    std::swap(size_, other.size_);
+  constexpr void swap(Array& other) {
+    for (size_type i = 0; i < N; ++i) {
+      value_type tmp = static_cast<value_type&&>(data_[i]);
+      data_[i] = static_cast<value_type&&>(other.data_[i]);
+      other.data_[i] = static_cast<value_type&&>(tmp);
+    }
   }
 
-  void fill(const_reference value) { std::fill(begin(), end(), value); }
-
-  // Изменение размера массива
-  void resize(size_type newSize) {
-    T* newData = new T[newSize];
-    size_type minSize = (newSize < size_) ? newSize : size_;
-    std::copy(data, data + minSize, newData);
-    delete[] data;
-    data = newData;
-    size_ = newSize;
+  constexpr void fill(const_reference value) {
+    for (size_type i = 0; i < N; ++i) data_[i] = value;
   }
 };
-template class Array<int>;
-template class Array<double>;
-template class Array<char>;
-template class Array<float>;
+
+// Array Comparison
+template <class T, std::size_t N, std::size_t A>
+constexpr bool operator==(const Array<T, N, A>& lhs,
+                          const Array<T, N, A>& rhs) {
+  for (std::size_t i = 0; i < N; ++i) {
+    if (!(lhs[i] == rhs[i])) return false;
+  }
+  return true;
+}
+
+template <class T, std::size_t N, std::size_t A>
+constexpr bool operator!=(const Array<T, N, A>& lhs,
+                          const Array<T, N, A>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <class T, std::size_t N, std::size_t A>
+constexpr bool operator<(const Array<T, N, A>& lhs,
+                         const Array<T, N, A>& rhs) {
+  for (std::size_t i = 0; i < N; ++i) {
+    if (lhs[i] < rhs[i]) return true;
+    if (rhs[i] < lhs[i]) return false;
+  }
+  return false;
+}
+
+template <class T, std::size_t N, std::size_t A>
+constexpr bool operator>(const Array<T, N, A>& lhs,
+                         const Array<T, N, A>& rhs) {
+  return rhs < lhs;
+}
+
+template <class T, std::size_t N, std::size_t A>
+constexpr bool operator<=(const Array<T, N, A>& lhs,
+                          const Array<T, N, A>& rhs) {
+  return !(rhs < lhs);
+}
+
+template <class T, std::size_t N, std::size_t A>
+constexpr bool operator>=(const Array<T, N, A>& lhs,
+                          const Array<T, N, A>& rhs) {
+  return !(lhs < rhs);
+}
+
+template <class T, std::size_t N, std::size_t A>
+constexpr void swap(Array<T, N, A>& lhs, Array<T, N, A>& rhs) {
+  lhs.swap(rhs);
+}
 }  // namespace s21
 #endif  // ARRAY_H
@@ -0,0 +1,140 @@
+#include <queue>
+#include <stack>
+#include <utility>
+
+#include "../queue/queue.h"
+#include "../stack/stack.h"
+#include "bench_common.h"
+
+namespace {
+using s21_bench::Measured;
+using s21_bench::PauseTiming;
+using s21_bench::ResumeTiming;
+using s21_bench::SetItems;
+using s21_bench::Values;
+using s21_bench::Weight;
+
+template <class C>
+using Value = typename C::value_type;
+
+template <class C>
+C Pushed(const std::vector<Value<C>> &values) {
+  C c;
+  for (const auto &value : values) c.push(value);
+  return c;
+}
+
+// Peeks at the element push/pop operate on: top() for stacks, front() for
+// queues (plus back()).
+template <class T, class Container>
+std::size_t Peek(s21::Stack<T, Container> &c) {
+  return Weight(c.top());
+}
+template <class T, class Container>
+std::size_t Peek(std::stack<T, Container> &c) {
+  return Weight(c.top());
+}
+template <class T, class Container>
+std::size_t Peek(s21::Queue<T, Container> &c) {
+  return Weight(c.front()) + Weight(c.back());
+}
+template <class T, class Container>
+std::size_t Peek(std::queue<T, Container> &c) {
+  return Weight(c.front()) + Weight(c.back());
+}
+
+template <class C>
+void BM_AdaptorPush(benchmark::State &state) {
+  const auto values = Values<Value<C>>(state.range(0));
+  for (auto _ : Measured(state, state.range(0))) {
+    C c;
+    for (const auto &value : values) c.push(value);
+    benchmark::DoNotOptimize(&c);
+  }
+  SetItems(state, state.range(0));
+}
+
+template <class C>
+void BM_AdaptorPop(benchmark::State &state) {
+  const auto values = Values<Value<C>>(state.range(0));
+  for (auto _ : Measured(state, state.range(0))) {
+    PauseTiming(state);
+    C c = Pushed<C>(values);
+    ResumeTiming(state);
+    while (!c.empty()) c.pop();
+  }
+  SetItems(state, state.range(0));
+}
+
+// One push/pop pair on an adaptor holding n elements.
+template <class C>
+void BM_AdaptorPushPop(benchmark::State &state) {
+  C c = Pushed<C>(Values<Value<C>>(state.range(0)));
+  const Value<C> value = s21_bench::MakeValue<Value<C>>(1);
+  for (auto _ : Measured(state)) {
+    c.push(value);
+    c.pop();
+  }
+  benchmark::DoNotOptimize(&c);
+}
+
+template <class C>
+void BM_AdaptorPeek(benchmark::State &state) {
+  C c = Pushed<C>(Values<Value<C>>(state.range(0)));
+  for (auto _ : Measured(state)) {
+    benchmark::DoNotOptimize(Peek(c));
+  }
+}
+
+template <class C>
+void BM_AdaptorCapacity(benchmark::State &state) {
+  C c = Pushed<C>(Values<Value<C>>(state.range(0)));
+  for (auto _ : Measured(state)) {
+    benchmark::DoNotOptimize(c.size() + c.empty());
+  }
+}
+
+template <class C>
+void BM_AdaptorCopy(benchmark::State &state) {
+  const C source = Pushed<C>(Values<Value<C>>(state.range(0)));
+  for (auto _ : Measured(state, state.range(0))) {
+    C copy(source);
+    benchmark::DoNotOptimize(&copy);
+  }
+  SetItems(state, state.range(0));
+}
+
+// Move construction followed by move assignment back into the source.
+template <class C>
+void BM_AdaptorMove(benchmark::State &state) {
+  C source = Pushed<C>(Values<Value<C>>(state.range(0)));
+  for (auto _ : Measured(state)) {
+    C moved(std::move(source));
+    source = std::move(moved);
+    benchmark::DoNotOptimize(&source);
+  }
+}
+
+template <class C>
+void BM_AdaptorSwap(benchmark::State &state) {
+  C a = Pushed<C>(Values<Value<C>>(state.range(0)));
+  C b;
+  for (auto _ : Measured(state)) {
+    a.swap(b);
+    benchmark::DoNotOptimize(&a);
+  }
+}
+}  // namespace
+
+#define S21_ADAPTOR_BENCH(fn)                                              \
+  S21_BENCH_PAIR(fn, s21::Stack, std::stack, s21_bench::Sizes);            \
+  S21_BENCH_PAIR(fn, s21::Queue, std::queue, s21_bench::Sizes)
+
+S21_ADAPTOR_BENCH(BM_AdaptorPush);
+S21_ADAPTOR_BENCH(BM_AdaptorPop);
+S21_ADAPTOR_BENCH(BM_AdaptorPushPop);
+S21_ADAPTOR_BENCH(BM_AdaptorPeek);
+S21_ADAPTOR_BENCH(BM_AdaptorCapacity);
+S21_ADAPTOR_BENCH(BM_AdaptorCopy);
+S21_ADAPTOR_BENCH(BM_AdaptorMove);
+S21_ADAPTOR_BENCH(BM_AdaptorSwap);
@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "../memory/aligned_allocator.h"
+#include "../vector/vector.h"
+#include "bench_common.h"
+
+namespace {
+using s21_bench::HugeRequested;
+using s21_bench::Measured;
+
+// Random reads over a large vector: every access lands on a different page,
+// so the cost is dominated by TLB misses. Backing the buffer with 2MB pages
+// cuts the number of distinct translations by 512x. Run with S21_PERF=1 to
+// see the difference in dtlb_misses/op. The sweep stops at 1GB; S21_HUGE=1
+// adds a 4GB vector, more than the TLB covers even in 2MB pages.
+constexpr std::int64_t kHugeSize = std::int64_t(1) << 30;
+
+void Footprints(benchmark::internal::Benchmark *b) {
+  b->RangeMultiplier(4)->Range(1 << 22, 1 << 28);
+  if (HugeRequested()) b->Arg(kHugeSize);
+}
+
+template <class Allocator>
+void BM_RandomRead(benchmark::State &state) {
+  using Vec = s21::Vector<std::uint32_t, Allocator>;
+  const std::size_t n = static_cast<std::size_t>(state.range(0));
+  Vec v(n);
+  for (std::size_t i = 0; i < n; ++i) v[i] = static_cast<std::uint32_t>(i);
+  std::uint64_t index = 1;
+  std::uint64_t sum = 0;
+  for (auto _ : Measured(state, 4096)) {
+    for (int i = 0; i < 4096; ++i) {
+      index = index * 6364136223846793005ULL + 1442695040888963407ULL;
+      sum += v[(index >> 17) % n];
+    }
+  }
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations() * 4096);
+}
+
+template <class Allocator>
+void BM_SequentialFill(benchmark::State &state) {
+  using Vec = s21::Vector<std::uint32_t, Allocator>;
+  Vec v(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < v.size(); ++i) {
+      v[i] = static_cast<std::uint32_t>(i);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * 4);
+}
+
+using DefaultAlloc = std::allocator<std::uint32_t>;
+using CacheLineAlloc =
+    s21::AlignedAllocator<std::uint32_t, s21::kCacheLineSize>;
+using HugePageAlloc =
+    s21::AlignedAllocator<std::uint32_t, s21::kCacheLineSize, true>;
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_RandomRead, DefaultAlloc)->Apply(Footprints);
+BENCHMARK_TEMPLATE(BM_RandomRead, HugePageAlloc)->Apply(Footprints);
+BENCHMARK_TEMPLATE(BM_SequentialFill, DefaultAlloc)->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(BM_SequentialFill, CacheLineAlloc)->Range(1 << 10, 1 << 24);
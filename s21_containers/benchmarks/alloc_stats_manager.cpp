@@ -0,0 +1,37 @@
+#include <benchmark/benchmark.h>
+
+#include "../memory/alloc_stats.h"
+
+// With S21_ALLOC_STATS the suite registers a memory manager backed by
+// s21::stats::total(): every case gets one extra run whose container
+// allocations land in the JSON output as allocs_per_iter, max_bytes_used,
+// total_allocated_bytes and net_heap_growth. std baselines allocate through
+// std::allocator directly and report zero.
+#ifdef S21_ALLOC_STATS
+namespace {
+class StatsMemoryManager : public benchmark::MemoryManager {
+ public:
+  void Start() override {
+    s21::stats::reset_total();
+    start_live_ = s21::stats::total().live_bytes;
+  }
+
+  void Stop(Result &result) override {
+    const s21::stats::Counters c = s21::stats::total();
+    result.num_allocs = static_cast<int64_t>(c.allocations);
+    result.max_bytes_used = static_cast<int64_t>(c.peak_bytes - start_live_);
+    result.total_allocated_bytes = static_cast<int64_t>(c.bytes_allocated);
+    result.net_heap_growth = static_cast<int64_t>(c.bytes_allocated) -
+                             static_cast<int64_t>(c.bytes_deallocated);
+  }
+
+  void Stop(Result *result) override { Stop(*result); }
+
+ private:
+  std::size_t start_live_ = 0;
+};
+
+StatsMemoryManager manager;
+const bool registered = (benchmark::RegisterMemoryManager(&manager), true);
+}  // namespace
+#endif
@@ -0,0 +1,159 @@
+#include <array>
+#include <memory>
+
+#include "../array/array.h"
+#include "bench_common.h"
+
+namespace {
+using s21_bench::Measured;
+using s21_bench::PauseTiming;
+using s21_bench::ResumeTiming;
+using s21_bench::SetItems;
+using s21_bench::Weight;
+
+template <class A>
+using Value = typename A::value_type;
+
+// Arrays of up to 1e7 elements do not fit on the stack: keep them on the
+// heap and fill them with MakeValue(i).
+template <class A>
+std::unique_ptr<A> MakeArray() {
+  auto a = std::make_unique<A>();
+  for (std::size_t i = 0; i < a->size(); ++i) {
+    (*a)[i] = s21_bench::MakeValue<Value<A>>(i);
+  }
+  return a;
+}
+
+template <class A>
+void BM_ArrayFill(benchmark::State &state) {
+  auto a = MakeArray<A>();
+  const Value<A> value = s21_bench::MakeValue<Value<A>>(7);
+  for (auto _ : Measured(state, a->size())) {
+    a->fill(value);
+    benchmark::ClobberMemory();
+  }
+  SetItems(state, a->size());
+}
+
+template <class A>
+void BM_ArrayAt(benchmark::State &state) {
+  auto a = MakeArray<A>();
+  const auto order = s21_bench::Shuffled(a->size());
+  for (auto _ : Measured(state, a->size())) {
+    std::size_t sum = 0;
+    for (std::size_t i : order) sum += Weight(a->at(i));
+    benchmark::DoNotOptimize(sum);
+  }
+  SetItems(state, a->size());
+}
+
+template <class A>
+void BM_ArraySubscript(benchmark::State &state) {
+  auto a = MakeArray<A>();
+  const auto order = s21_bench::Shuffled(a->size());
+  for (auto _ : Measured(state, a->size())) {
+    std::size_t sum = 0;
+    for (std::size_t i : order) sum += Weight((*a)[i]);
+    benchmark::DoNotOptimize(sum);
+  }
+  SetItems(state, a->size());
+}
+
+template <class A>
+void BM_ArrayFrontBack(benchmark::State &state) {
+  auto a = MakeArray<A>();
+  for (auto _ : Measured(state)) {
+    benchmark::DoNotOptimize(Weight(a->front()) + Weight(a->back()));
+  }
+}
+
+template <class A>
+void BM_ArrayIterate(benchmark::State &state) {
+  auto a = MakeArray<A>();
+  for (auto _ : Measured(state, a->size())) {
+    std::size_t sum = 0;
+    for (const auto &value : *a) sum += Weight(value);
+    benchmark::DoNotOptimize(sum);
+  }
+  SetItems(state, a->size());
+}
+
+template <class A>
+void BM_ArrayData(benchmark::State &state) {
+  auto a = MakeArray<A>();
+  for (auto _ : Measured(state, a->size())) {
+    const auto *data = a->data();
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < a->size(); ++i) sum += Weight(data[i]);
+    benchmark::DoNotOptimize(sum);
+  }
+  SetItems(state, a->size());
+}
+
+template <class A>
+void BM_ArrayCapacity(benchmark::State &state) {
+  auto a = MakeArray<A>();
+  for (auto _ : Measured(state)) {
+    benchmark::DoNotOptimize(a->size() + a->empty() + a->max_size());
+  }
+}
+
+template <class A>
+void BM_ArraySwap(benchmark::State &state) {
+  auto a = MakeArray<A>();
+  auto b = MakeArray<A>();
+  for (auto _ : Measured(state, a->size())) {
+    a->swap(*b);
+    benchmark::ClobberMemory();
+  }
+  SetItems(state, a->size());
+}
+
+template <class A>
+void BM_ArrayCopy(benchmark::State &state) {
+  auto a = MakeArray<A>();
+  auto b = std::make_unique<A>();
+  for (auto _ : Measured(state, a->size())) {
+    *b = *a;
+    benchmark::ClobberMemory();
+  }
+  SetItems(state, a->size());
+}
+
+// Equal arrays: == has to compare every element.
+template <class A>
+void BM_ArrayCompare(benchmark::State &state) {
+  auto a = MakeArray<A>();
+  auto b = MakeArray<A>();
+  for (auto _ : Measured(state, a->size())) {
+    benchmark::DoNotOptimize(*a == *b);
+  }
+  SetItems(state, a->size());
+}
+}  // namespace
+
+// Array sizes are template arguments, so each size is its own instantiation.
+#define S21_ARRAY_BENCH_SIZE(fn, T, N)         \
+  BENCHMARK_TEMPLATE(fn, s21::Array<T, N>); \
+  BENCHMARK_TEMPLATE(fn, std::array<T, N>)
+
+#define S21_ARRAY_BENCH(fn)                       \
+  S21_ARRAY_BENCH_SIZE(fn, int, 100);             \
+  S21_ARRAY_BENCH_SIZE(fn, int, 10000);           \
+  S21_ARRAY_BENCH_SIZE(fn, int, 1000000);         \
+  S21_ARRAY_BENCH_SIZE(fn, int, 10000000);        \
+  S21_ARRAY_BENCH_SIZE(fn, std::string, 100);     \
+  S21_ARRAY_BENCH_SIZE(fn, std::string, 10000);   \
+  S21_ARRAY_BENCH_SIZE(fn, std::string, 1000000)
+
+S21_ARRAY_BENCH(BM_ArrayFill);
+S21_ARRAY_BENCH(BM_ArrayAt);
+S21_ARRAY_BENCH(BM_ArraySubscript);
+S21_ARRAY_BENCH(BM_ArrayFrontBack);
+S21_ARRAY_BENCH(BM_ArrayIterate);
+S21_ARRAY_BENCH(BM_ArrayData);
+S21_ARRAY_BENCH(BM_ArrayCapacity);
+S21_ARRAY_BENCH(BM_ArraySwap);
+S21_ARRAY_BENCH(BM_ArrayCopy);
+S21_ARRAY_BENCH(BM_ArrayCompare);
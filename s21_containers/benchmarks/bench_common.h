@@ -0,0 +1,117 @@
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <numeric>
+#include <random>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "perf_counters.h"
+
+// Shared pieces of the container suite: size sweeps, element generators and
+// the registration macro that puts every s21 case next to its std baseline.
+namespace s21_bench {
+constexpr std::int64_t kMinSize = 100;
+constexpr std::int64_t kMaxSize = 10000000;
+// std::string elements own heap memory, so their sweep stops one decade
+// earlier to keep the peak footprint of node-based containers sane.
+constexpr std::int64_t kMaxStringSize = 1000000;
+
+template <class T>
+T MakeValue(std::size_t i);
+template <>
+inline int MakeValue<int>(std::size_t i) {
+  return static_cast<int>(i);
+}
+template <>
+inline std::string MakeValue<std::string>(std::size_t i) {
+  // Longer than the small-string buffer: every element allocates.
+  return "value-" + std::to_string(i) + "-padded-past-sso";
+}
+
+/// 0..n-1 in a fixed pseudo-random order.
+inline std::vector<std::size_t> Shuffled(std::size_t n) {
+  std::vector<std::size_t> order(n);
+  std::iota(order.begin(), order.end(), std::size_t(0));
+  std::shuffle(order.begin(), order.end(), std::mt19937_64(42));
+  return order;
+}
+
+/// MakeValue(0..n-1), shuffled unless `sorted`.
+template <class T>
+std::vector<T> Values(std::size_t n, bool sorted = false) {
+  std::vector<T> values;
+  values.reserve(n);
+  if (sorted) {
+    for (std::size_t i = 0; i < n; ++i) values.push_back(MakeValue<T>(i));
+    std::sort(values.begin(), values.end());
+  } else {
+    for (std::size_t i : Shuffled(n)) values.push_back(MakeValue<T>(i));
+  }
+  return values;
+}
+
+/// Anything with a size (strings) or the value itself, to fold elements
+/// into a checksum the optimizer cannot drop.
+inline std::size_t Weight(int value) { return static_cast<std::size_t>(value); }
+inline std::size_t Weight(const std::string &value) { return value.size(); }
+
+/// Sequence containers filled in `values` order with push_back.
+template <class C, class T>
+C Filled(const std::vector<T> &values) {
+  C c;
+  for (const T &value : values) c.push_back(value);
+  return c;
+}
+
+/// C++17 std::set/std::map have no contains().
+template <class C, class K>
+bool Contains(C &c, const K &key) {
+  return c.contains(key);
+}
+template <class K, class... Rest>
+bool Contains(std::set<K, Rest...> &c, const K &key) {
+  return c.count(key) != 0;
+}
+template <class K, class V, class... Rest>
+bool Contains(std::map<K, V, Rest...> &c, const K &key) {
+  return c.count(key) != 0;
+}
+
+template <class T>
+void Sizes(benchmark::internal::Benchmark *b) {
+  b->RangeMultiplier(10)->Range(
+      kMinSize, std::is_same_v<T, std::string> ? kMaxStringSize : kMaxSize);
+}
+
+/// Whether S21_HUGE=1 asks for the multi-GB sizes some sweeps skip by
+/// default.
+inline bool HugeRequested() {
+  const char *env = std::getenv("S21_HUGE");
+  return env && std::strcmp(env, "0") != 0;
+}
+
+/// Items per second for one pass over n elements per iteration.
+inline void SetItems(benchmark::State &state, std::int64_t per_iteration) {
+  state.SetItemsProcessed(state.iterations() * per_iteration);
+}
+}  // namespace s21_bench
+
+/// Registers `fn` for the s21 container and its std baseline, each with int
+/// and std::string elements. S21 and Std are class templates of one type.
+#define S21_BENCH_PAIR(fn, S21, Std, sizes)                          \
+  BENCHMARK_TEMPLATE(fn, S21<int>)->Apply(sizes<int>);                 \
+  BENCHMARK_TEMPLATE(fn, Std<int>)->Apply(sizes<int>);                 \
+  BENCHMARK_TEMPLATE(fn, S21<std::string>)->Apply(sizes<std::string>); \
+  BENCHMARK_TEMPLATE(fn, Std<std::string>)->Apply(sizes<std::string>)
+
+#endif  // BENCH_COMMON_H
@@ -0,0 +1,88 @@
+#include <mutex>
+#include <shared_mutex>
+
+#include "../setMap/concurrent/s21_concurrent_map.h"
+#include "bench_common.h"
+
+namespace {
+using s21_bench::Measured;
+using s21_bench::SetItems;
+using s21_bench::Values;
+
+constexpr std::size_t kKeys = 1 << 16;
+// Thread 0 replaces one value per kWriteEvery operations; every other
+// operation on every thread is a lookup.
+constexpr std::size_t kWriteEvery = 1024;
+
+// The same PersistentMap behind each kind of synchronization, so the cases
+// differ in how readers get at it and nothing else.
+struct RcuMap {
+  bool Lookup(int key) const { return map.contains(key); }
+  void Update(int key, int value) { map.insert_or_assign(key, value); }
+
+  s21::ConcurrentMap<int, int> map;
+};
+
+struct MutexMap {
+  bool Lookup(int key) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return map.contains(key);
+  }
+  void Update(int key, int value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    map = map.insert_or_assign(key, value);
+  }
+
+  mutable std::mutex mutex;
+  s21::PersistentMap<int, int> map;
+};
+
+struct SharedMutexMap {
+  bool Lookup(int key) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return map.contains(key);
+  }
+  void Update(int key, int value) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    map = map.insert_or_assign(key, value);
+  }
+
+  mutable std::shared_mutex mutex;
+  s21::PersistentMap<int, int> map;
+};
+
+// Built once and shared by every thread count.
+template <class M>
+M &Shared() {
+  static M *map = [] {
+    M *built = new M;
+    for (int key : Values<int>(kKeys, true)) built->Update(key, key);
+    return built;
+  }();
+  return *map;
+}
+
+template <class M>
+void BM_ReadMostly(benchmark::State &state) {
+  M &map = Shared<M>();
+  const auto keys = Values<int>(kKeys);
+  std::size_t i = state.thread_index() * 7919, found = 0;
+  for (auto _ : Measured(state)) {
+    const int key = keys[++i % kKeys];
+    if (state.thread_index() == 0 && i % kWriteEvery == 0) {
+      map.Update(key, static_cast<int>(i));
+    } else {
+      found += map.Lookup(key);
+    }
+  }
+  benchmark::DoNotOptimize(found);
+  SetItems(state, 1);
+}
+}  // namespace
+
+#define S21_CONCURRENT_MAP_BENCH(M) \
+  BENCHMARK_TEMPLATE(BM_ReadMostly, M)->ThreadRange(1, 64)->UseRealTime()
+
+S21_CONCURRENT_MAP_BENCH(RcuMap);
+S21_CONCURRENT_MAP_BENCH(MutexMap);
+S21_CONCURRENT_MAP_BENCH(SharedMutexMap);
@@ -0,0 +1,86 @@
+#include <mutex>
+
+#include "../setMap/concurrent/s21_concurrent_set.h"
+#include "../setMap/set/s21_set.tpp"
+#include "bench_common.h"
+
+namespace {
+using s21_bench::Measured;
+using s21_bench::SetItems;
+using s21_bench::Values;
+
+constexpr std::size_t kKeys = 1 << 16;
+
+struct SkipListSet {
+  bool Contains(int key) const { return set.contains(key); }
+  void Insert(int key) { set.insert(key); }
+  void Erase(int key) { set.erase(key); }
+
+  s21::ConcurrentSet<int> set;
+};
+
+// The baseline: s21::Set cannot be written concurrently at all.
+struct LockedSet {
+  bool Contains(int key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return set.contains(key);
+  }
+  void Insert(int key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    set.insert(key);
+  }
+  void Erase(int key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    set.erase(set.find(key));
+  }
+
+  std::mutex mutex;
+  s21::Set<int> set;
+};
+
+// Half the keys present, so inserts and erases both mostly succeed.
+template <class S>
+S &Shared() {
+  static S *set = [] {
+    S *built = new S;
+    for (int key : Values<int>(kKeys / 2)) built->Insert(key * 2);
+    return built;
+  }();
+  return *set;
+}
+
+// range(0) is the percentage of writes, split evenly between inserts and
+// erases; the rest are lookups.
+template <class S>
+void BM_MixedSet(benchmark::State &state) {
+  S &set = Shared<S>();
+  const auto keys = Values<int>(kKeys);
+  const std::size_t writes = state.range(0);
+  std::size_t i = state.thread_index() * 7919;
+  std::size_t found = 0;
+  for (auto _ : Measured(state)) {
+    const int key = keys[++i % kKeys];
+    const std::size_t roll = (i * 2654435761u >> 8) % 100;
+    if (roll >= writes) {
+      found += set.Contains(key);
+    } else if (roll % 2) {
+      set.Insert(key);
+    } else {
+      set.Erase(key);
+    }
+  }
+  benchmark::DoNotOptimize(found);
+  SetItems(state, 1);
+}
+}  // namespace
+
+#define S21_CONCURRENT_SET_BENCH(S)                                     \
+  BENCHMARK_TEMPLATE(BM_MixedSet, S)                                    \
+      ->ArgName("write%")                                               \
+      ->Arg(10)                                                         \
+      ->Arg(50)                                                         \
+      ->ThreadRange(1, 64)                                              \
+      ->UseRealTime()
+
+S21_CONCURRENT_SET_BENCH(SkipListSet);
+S21_CONCURRENT_SET_BENCH(LockedSet);
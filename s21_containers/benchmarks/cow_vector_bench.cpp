@@ -0,0 +1,75 @@
+#include "../vector/cow_vector.h"
+#include "../vector/vector.h"
+#include "bench_common.h"
+
+namespace {
+using s21_bench::Filled;
+using s21_bench::Measured;
+using s21_bench::SetItems;
+using s21_bench::Values;
+using s21_bench::Weight;
+
+template <class C>
+using Value = typename C::value_type;
+
+template <class C>
+std::size_t Checksum(const C &c) {
+  std::size_t sum = 0;
+  const auto *items = c.data();
+  for (std::size_t i = 0; i < c.size(); ++i) sum += Weight(items[i]);
+  return sum;
+}
+
+// A copy handed to a reader: O(1) for CowVector, O(n) for Vector.
+template <class C>
+void BM_CowCopy(benchmark::State &state) {
+  const C source = Filled<C>(Values<Value<C>>(state.range(0)));
+  for (auto _ : Measured(state)) {
+    C copy(source);
+    benchmark::DoNotOptimize(&copy);
+  }
+}
+
+// Read-mostly snapshots: each iteration copies the current vector and
+// reads it in full; one iteration in 64 also publishes a new version with
+// its last element replaced. The writer sticks to push_back/pop_back, as
+// non-const element access would make every later snapshot a deep copy.
+template <class C>
+void BM_CowSnapshotRead(benchmark::State &state) {
+  const std::size_t n = state.range(0);
+  const auto values = Values<Value<C>>(n);
+  C current = Filled<C>(values);
+  std::size_t round = 0;
+  for (auto _ : Measured(state, n)) {
+    if (++round % 64 == 0) {
+      C next(current);
+      next.pop_back();
+      next.push_back(values[(round / 64) % n]);
+      current = std::move(next);
+    }
+    const C snapshot(current);
+    benchmark::DoNotOptimize(Checksum(snapshot));
+  }
+  SetItems(state, n);
+}
+
+// The worst case for copy-on-write: every copy is written to at once.
+template <class C>
+void BM_CowCopyThenWrite(benchmark::State &state) {
+  const std::size_t n = state.range(0);
+  const C source = Filled<C>(Values<Value<C>>(n));
+  for (auto _ : Measured(state, n)) {
+    C copy(source);
+    copy.push_back(source[0]);
+    benchmark::DoNotOptimize(&copy);
+  }
+  SetItems(state, n);
+}
+}  // namespace
+
+#define S21_COW_VECTOR_BENCH(fn) \
+  S21_BENCH_PAIR(fn, s21::CowVector, s21::Vector, s21_bench::Sizes)
+
+S21_COW_VECTOR_BENCH(BM_CowCopy);
+S21_COW_VECTOR_BENCH(BM_CowSnapshotRead);
+S21_COW_VECTOR_BENCH(BM_CowCopyThenWrite);
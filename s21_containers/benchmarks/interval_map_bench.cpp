@@ -0,0 +1,75 @@
+#include <utility>
+#include <vector>
+
+#include "../setMap/interval/s21_interval_map.h"
+#include "bench_common.h"
+
+namespace {
+using s21_bench::Measured;
+using s21_bench::SetItems;
+using s21_bench::Shuffled;
+
+// Starts spread over ten slots per interval and lengths under 20: a
+// kQueryWidth window meets about a dozen intervals whatever the size, so
+// the tree's time should grow with log n only.
+constexpr int kMaxLength = 20;
+constexpr int kQueryWidth = 100;
+
+std::vector<std::pair<int, int>> Intervals(std::size_t n) {
+  std::vector<std::pair<int, int>> intervals;
+  intervals.reserve(n);
+  for (std::size_t i : Shuffled(n)) {
+    const int lo = static_cast<int>(i * 10 + i * 7 % 10);
+    intervals.push_back({lo, lo + 1 + static_cast<int>(i * 13 % kMaxLength)});
+  }
+  return intervals;
+}
+
+struct Tree {
+  explicit Tree(const std::vector<std::pair<int, int>> &intervals) {
+    for (const auto &[lo, hi] : intervals) map.insert(lo, hi, lo);
+  }
+  std::size_t Overlapping(int lo, int hi) {
+    std::size_t sum = 0;
+    for (const auto &item : map.overlapping(lo, hi)) sum += item.second;
+    return sum;
+  }
+
+  s21::IntervalMap<int, int> map;
+};
+
+// The baseline without an index: test every interval.
+struct Scan {
+  explicit Scan(const std::vector<std::pair<int, int>> &intervals)
+      : intervals(intervals) {}
+  std::size_t Overlapping(int lo, int hi) {
+    std::size_t sum = 0;
+    for (const auto &[from, to] : intervals) {
+      if (from < hi && lo < to) sum += from;
+    }
+    return sum;
+  }
+
+  std::vector<std::pair<int, int>> intervals;
+};
+
+template <class C>
+void BM_IntervalOverlap(benchmark::State &state) {
+  const std::size_t n = state.range(0);
+  C c(Intervals(n));
+  const std::size_t span = n * 10;
+  std::size_t i = 0;
+  for (auto _ : Measured(state)) {
+    const int lo = static_cast<int>((i += 7919) % span);
+    benchmark::DoNotOptimize(c.Overlapping(lo, lo + kQueryWidth));
+  }
+  SetItems(state, 1);
+}
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_IntervalOverlap, Tree)
+    ->RangeMultiplier(10)
+    ->Range(1000, s21_bench::kMaxSize);
+BENCHMARK_TEMPLATE(BM_IntervalOverlap, Scan)
+    ->RangeMultiplier(10)
+    ->Range(1000, s21_bench::kMaxSize);
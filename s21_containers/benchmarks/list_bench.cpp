@@ -0,0 +1,257 @@
+#include <list>
+#include <utility>
+
+#include "../list/list.h"
+#include "bench_common.h"
+
+namespace {
+using s21_bench::Filled;
+using s21_bench::Measured;
+using s21_bench::PauseTiming;
+using s21_bench::ResumeTiming;
+using s21_bench::SetItems;
+using s21_bench::Values;
+using s21_bench::Weight;
+
+template <class C>
+using Value = typename C::value_type;
+
+template <class C>
+void BM_ListConstruct(benchmark::State &state) {
+  const std::size_t n = state.range(0);
+  for (auto _ : Measured(state, n)) {
+    C c(n);
+    benchmark::DoNotOptimize(&c);
+  }
+  SetItems(state, n);
+}
+
+template <class C>
+void BM_ListCopy(benchmark::State &state) {
+  const C source = Filled<C>(Values<Value<C>>(state.range(0)));
+  for (auto _ : Measured(state, state.range(0))) {
+    C copy(source);
+    benchmark::DoNotOptimize(&copy);
+  }
+  SetItems(state, state.range(0));
+}
+
+// Move construction followed by move assignment back into the source.
+template <class C>
+void BM_ListMove(benchmark::State &state) {
+  C source = Filled<C>(Values<Value<C>>(state.range(0)));
+  for (auto _ : Measured(state)) {
+    C moved(std::move(source));
+    source = std::move(moved);
+    benchmark::DoNotOptimize(&source);
+  }
+}
+
+template <class C>
+void BM_ListPushBack(benchmark::State &state) {
+  const auto values = Values<Value<C>>(state.range(0));
+  for (auto _ : Measured(state, state.range(0))) {
+    C c;
+    for (const auto &value : values) c.push_back(value);
+    benchmark::DoNotOptimize(&c);
+  }
+  SetItems(state, state.range(0));
+}
+
+template <class C>
+void BM_ListPushFront(benchmark::State &state) {
+  const auto values = Values<Value<C>>(state.range(0));
+  for (auto _ : Measured(state, state.range(0))) {
+    C c;
+    for (const auto &value : values) c.push_front(value);
+    benchmark::DoNotOptimize(&c);
+  }
+  SetItems(state, state.range(0));
+}
+
+template <class C>
+void BM_ListPopBack(benchmark::State &state) {
+  const auto values = Values<Value<C>>(state.range(0));
+  for (auto _ : Measured(state, state.range(0))) {
+    PauseTiming(state);
+    C c = Filled<C>(values);
+    ResumeTiming(state);
+    while (!c.empty()) c.pop_back();
+  }
+  SetItems(state, state.range(0));
+}
+
+template <class C>
+void BM_ListPopFront(benchmark::State &state) {
+  const auto values = Values<Value<C>>(state.range(0));
+  for (auto _ : Measured(state, state.range(0))) {
+    PauseTiming(state);
+    C c = Filled<C>(values);
+    ResumeTiming(state);
+    while (!c.empty()) c.pop_front();
+  }
+  SetItems(state, state.range(0));
+}
+
+template <class C>
+void BM_ListFrontBack(benchmark::State &state) {
+  C c = Filled<C>(Values<Value<C>>(state.range(0)));
+  for (auto _ : Measured(state)) {
+    benchmark::DoNotOptimize(Weight(c.front()) + Weight(c.back()));
+  }
+}
+
+template <class C>
+void BM_ListIterate(benchmark::State &state) {
+  C c = Filled<C>(Values<Value<C>>(state.range(0)));
+  for (auto _ : Measured(state, state.range(0))) {
+    std::size_t sum = 0;
+    for (const auto &value : c) sum += Weight(value);
+    benchmark::DoNotOptimize(sum);
+  }
+  SetItems(state, state.range(0));
+}
+
+// size/empty/max_size in one pass.
+template <class C>
+void BM_ListCapacity(benchmark::State &state) {
+  C c = Filled<C>(Values<Value<C>>(state.range(0)));
+  for (auto _ : Measured(state)) {
+    benchmark::DoNotOptimize(c.size() + c.empty() + c.max_size());
+  }
+}
+
+// insert before the middle element and erase it again.
+template <class C>
+void BM_ListInsertEraseMiddle(benchmark::State &state) {
+  C c = Filled<C>(Values<Value<C>>(state.range(0)));
+  auto middle = c.begin();
+  for (std::int64_t i = 0; i < state.range(0) / 2; ++i) ++middle;
+  const Value<C> value = s21_bench::MakeValue<Value<C>>(1);
+  for (auto _ : Measured(state)) {
+    c.erase(c.insert(middle, value));
+  }
+  benchmark::DoNotOptimize(&c);
+}
+
+template <class C>
+void BM_ListClear(benchmark::State &state) {
+  const auto values = Values<Value<C>>(state.range(0));
+  for (auto _ : Measured(state, state.range(0))) {
+    PauseTiming(state);
+    C c = Filled<C>(values);
+    ResumeTiming(state);
+    c.clear();
+    benchmark::DoNotOptimize(&c);
+  }
+  SetItems(state, state.range(0));
+}
+
+template <class C>
+void BM_ListSwap(benchmark::State &state) {
+  C a = Filled<C>(Values<Value<C>>(state.range(0)));
+  C b;
+  for (auto _ : Measured(state)) {
+    a.swap(b);
+    benchmark::DoNotOptimize(&a);
+  }
+}
+
+// Merges two sorted lists of n/2 elements with interleaved values.
+template <class C>
+void BM_ListMerge(benchmark::State &state) {
+  const auto values = Values<Value<C>>(state.range(0), true);
+  std::vector<Value<C>> even, odd;
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    (i % 2 ? odd : even).push_back(values[i]);
+  }
+  for (auto _ : Measured(state, state.range(0))) {
+    PauseTiming(state);
+    C a = Filled<C>(even);
+    C b = Filled<C>(odd);
+    ResumeTiming(state);
+    a.merge(b);
+    benchmark::DoNotOptimize(&a);
+  }
+  SetItems(state, state.range(0));
+}
+
+// Splices a list of n/2 elements into the front of another.
+template <class C>
+void BM_ListSplice(benchmark::State &state) {
+  const auto values = Values<Value<C>>(state.range(0) / 2);
+  for (auto _ : Measured(state, state.range(0) / 2)) {
+    PauseTiming(state);
+    C a = Filled<C>(values);
+    C b = Filled<C>(values);
+    ResumeTiming(state);
+    a.splice(a.begin(), b);
+    benchmark::DoNotOptimize(&a);
+  }
+  SetItems(state, state.range(0) / 2);
+}
+
+template <class C>
+void BM_ListReverse(benchmark::State &state) {
+  C c = Filled<C>(Values<Value<C>>(state.range(0)));
+  for (auto _ : Measured(state, state.range(0))) {
+    c.reverse();
+    benchmark::DoNotOptimize(&c);
+  }
+  SetItems(state, state.range(0));
+}
+
+// Every value appears twice in a row.
+template <class C>
+void BM_ListUnique(benchmark::State &state) {
+  const auto values = Values<Value<C>>(state.range(0) / 2, true);
+  std::vector<Value<C>> doubled;
+  for (const auto &value : values) {
+    doubled.push_back(value);
+    doubled.push_back(value);
+  }
+  for (auto _ : Measured(state, state.range(0))) {
+    PauseTiming(state);
+    C c = Filled<C>(doubled);
+    ResumeTiming(state);
+    c.unique();
+    benchmark::DoNotOptimize(&c);
+  }
+  SetItems(state, state.range(0));
+}
+
+template <class C>
+void BM_ListSort(benchmark::State &state) {
+  const auto values = Values<Value<C>>(state.range(0));
+  for (auto _ : Measured(state, state.range(0))) {
+    PauseTiming(state);
+    C c = Filled<C>(values);
+    ResumeTiming(state);
+    c.sort();
+    benchmark::DoNotOptimize(&c);
+  }
+  SetItems(state, state.range(0));
+}
+}  // namespace
+
+#define S21_LIST_BENCH(fn) \
+  S21_BENCH_PAIR(fn, s21::List, std::list, s21_bench::Sizes)
+
+S21_LIST_BENCH(BM_ListConstruct);
+S21_LIST_BENCH(BM_ListCopy);
+S21_LIST_BENCH(BM_ListMove);
+S21_LIST_BENCH(BM_ListPushBack);
+S21_LIST_BENCH(BM_ListPushFront);
+S21_LIST_BENCH(BM_ListPopBack);
+S21_LIST_BENCH(BM_ListPopFront);
+S21_LIST_BENCH(BM_ListFrontBack);
+S21_LIST_BENCH(BM_ListIterate);
+S21_LIST_BENCH(BM_ListCapacity);
+S21_LIST_BENCH(BM_ListInsertEraseMiddle);
+S21_LIST_BENCH(BM_ListClear);
+S21_LIST_BENCH(BM_ListSwap);
+S21_LIST_BENCH(BM_ListMerge);
+S21_LIST_BENCH(BM_ListSplice);
+S21_LIST_BENCH(BM_ListReverse);
+S21_LIST_BENCH(BM_ListUnique);
+S21_LIST_BENCH(BM_ListSort);
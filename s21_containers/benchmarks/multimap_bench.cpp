@@ -0,0 +1,94 @@
+#include <map>
+
+#include "../list/list.h"
+#include "../setMap/map/s21_map.tpp"
+#include "../setMap/multimap/s21_multimap.tpp"
+#include "bench_common.h"
+
+namespace {
+using s21_bench::Measured;
+using s21_bench::SetItems;
+using s21_bench::Values;
+
+// Every key holds this many values.
+constexpr int kPerKey = 8;
+
+struct Flat {
+  void Add(int key, int value) { map.insert(key, value); }
+  long Sum(int key) {
+    long sum = 0;
+    for (auto [it, last] = map.equal_range(key); it != last; ++it) {
+      sum += it->second;
+    }
+    return sum;
+  }
+
+  s21::Multimap<int, int> map;
+};
+
+// The workaround Multimap replaces: a list node per value plus the list
+// itself, one more hop away.
+struct Nested {
+  void Add(int key, int value) { map[key].push_back(value); }
+  long Sum(int key) {
+    long sum = 0;
+    for (int value : map.at(key)) sum += value;
+    return sum;
+  }
+
+  s21::Map<int, s21::List<int>> map;
+};
+
+struct Std {
+  void Add(int key, int value) { map.insert({key, value}); }
+  long Sum(int key) {
+    long sum = 0;
+    for (auto [it, last] = map.equal_range(key); it != last; ++it) {
+      sum += it->second;
+    }
+    return sum;
+  }
+
+  std::multimap<int, int> map;
+};
+
+// n values spread over n / kPerKey keys, in shuffled order.
+template <class M>
+void Fill(M &m, const std::vector<int> &order) {
+  for (int i : order) m.Add(i / kPerKey, i);
+}
+
+template <class M>
+void BM_MultiInsert(benchmark::State &state) {
+  const auto order = Values<int>(state.range(0));
+  for (auto _ : Measured(state, state.range(0))) {
+    M m;
+    Fill(m, order);
+    benchmark::DoNotOptimize(&m);
+  }
+  SetItems(state, state.range(0));
+}
+
+// Sums the values of every key.
+template <class M>
+void BM_MultiLookup(benchmark::State &state) {
+  const auto order = Values<int>(state.range(0));
+  M m;
+  Fill(m, order);
+  const auto keys = Values<int>(state.range(0) / kPerKey);
+  for (auto _ : Measured(state, state.range(0))) {
+    long sum = 0;
+    for (int key : keys) sum += m.Sum(key);
+    benchmark::DoNotOptimize(sum);
+  }
+  SetItems(state, state.range(0));
+}
+}  // namespace
+
+#define S21_MULTIMAP_BENCH(fn)                                   \
+  BENCHMARK_TEMPLATE(fn, Flat)->Apply(s21_bench::Sizes<int>);     \
+  BENCHMARK_TEMPLATE(fn, Nested)->Apply(s21_bench::Sizes<int>);   \
+  BENCHMARK_TEMPLATE(fn, Std)->Apply(s21_bench::Sizes<int>)
+
+S21_MULTIMAP_BENCH(BM_MultiInsert);
+S21_MULTIMAP_BENCH(BM_MultiLookup);
@@ -0,0 +1,86 @@
+#include <memory>
+
+#include "../concurrency/thread_pool.h"
+#include "../setMap/map/s21_map.tpp"
+#include "../setMap/set/s21_set.tpp"
+#include "bench_common.h"
+
+namespace {
+using s21_bench::Measured;
+using s21_bench::PauseTiming;
+using s21_bench::ResumeTiming;
+using s21_bench::SetItems;
+using s21_bench::Values;
+
+// Copy and teardown of one large tree against the threads tree_parallel
+// may use: range(0) is the tree size, range(1) the threads including the
+// caller, 1 meaning the sequential code.
+void Scaling(benchmark::internal::Benchmark *b) {
+  for (std::int64_t size : {std::int64_t(1000000), s21_bench::kMaxSize}) {
+    for (std::int64_t threads : {1, 2, 4, 8}) b->Args({size, threads});
+  }
+  b->ArgNames({"n", "threads"})->Unit(benchmark::kMillisecond);
+}
+
+// Enables tree_parallel on a pool of range(1) threads for one case.
+class Parallel {
+ public:
+  explicit Parallel(benchmark::State &state)
+      : pool_(static_cast<std::size_t>(state.range(1) - 1)),
+        guard_(pool_, kThreshold) {}
+
+ private:
+  static constexpr std::size_t kThreshold = 1 << 16;
+  s21::ThreadPool pool_;
+  s21::tree_parallel::Guard guard_;
+};
+
+template <class T>
+void Add(s21::Set<T> &c, const T &key) {
+  c.insert(key);
+}
+template <class T>
+void Add(s21::Map<T, T> &c, const T &key) {
+  c.insert(key, key);
+}
+
+template <class C>
+std::unique_ptr<C> Built(std::int64_t n) {
+  auto c = std::make_unique<C>();
+  for (const auto &key : Values<typename C::key_type>(n)) Add(*c, key);
+  return c;
+}
+
+template <class C>
+void BM_ParallelCopy(benchmark::State &state) {
+  const auto source = Built<C>(state.range(0));
+  Parallel parallel(state);
+  for (auto _ : Measured(state, state.range(0))) {
+    auto copy = std::make_unique<C>(*source);
+    benchmark::DoNotOptimize(copy.get());
+    PauseTiming(state);
+    copy.reset();
+    ResumeTiming(state);
+  }
+  SetItems(state, state.range(0));
+}
+
+template <class C>
+void BM_ParallelClear(benchmark::State &state) {
+  const auto source = Built<C>(state.range(0));
+  Parallel parallel(state);
+  for (auto _ : Measured(state, state.range(0))) {
+    PauseTiming(state);
+    auto c = std::make_unique<C>(*source);
+    ResumeTiming(state);
+    c->clear();
+    benchmark::DoNotOptimize(c.get());
+  }
+  SetItems(state, state.range(0));
+}
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_ParallelCopy, s21::Set<int>)->Apply(Scaling);
+BENCHMARK_TEMPLATE(BM_ParallelCopy, s21::Map<int, int>)->Apply(Scaling);
+BENCHMARK_TEMPLATE(BM_ParallelClear, s21::Set<int>)->Apply(Scaling);
+BENCHMARK_TEMPLATE(BM_ParallelClear, s21::Map<int, int>)->Apply(Scaling);
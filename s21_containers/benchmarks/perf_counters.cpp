@@ -0,0 +1,152 @@
+#include "perf_counters.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace s21_bench {
+namespace {
+thread_local PerfCounters *current = nullptr;
+
+bool Requested() {
+  const char *env = std::getenv("S21_PERF");
+  return env && std::strcmp(env, "0") != 0;
+}
+
+#ifdef __linux__
+struct Event {
+  const char *name;
+  std::uint32_t type;
+  std::uint64_t config;
+};
+
+constexpr std::uint64_t CacheMiss(std::uint64_t cache) {
+  return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+         (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+// Order matters: Report derives IPC from the first two.
+const Event kEventTable[PerfCounters::kEvents] = {
+    {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {"l1d_misses", PERF_TYPE_HW_CACHE, CacheMiss(PERF_COUNT_HW_CACHE_L1D)},
+    {"llc_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {"branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {"dtlb_misses", PERF_TYPE_HW_CACHE, CacheMiss(PERF_COUNT_HW_CACHE_DTLB)},
+};
+
+int Open(const Event &event) {
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = event.type;
+  attr.config = event.config;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  // More events than hardware counters get multiplexed; the enabled and
+  // running times let Report scale them back.
+  attr.read_format =
+      PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+#endif
+}  // namespace
+
+PerfCounters::PerfCounters() {
+  for (int &fd : fds_) fd = -1;
+  if (!Requested()) return;
+#ifdef __linux__
+  for (int i = 0; i < kEvents; ++i) {
+    fds_[i] = Open(kEventTable[i]);
+    active_ = active_ || fds_[i] >= 0;
+  }
+#endif
+  if (!active_) {
+    static bool warned = false;
+    if (!warned) {
+      std::cerr << "S21_PERF: no hardware counters available\n";
+      warned = true;
+    }
+  }
+}
+
+PerfCounters::~PerfCounters() {
+#ifdef __linux__
+  for (int fd : fds_) {
+    if (fd >= 0) close(fd);
+  }
+#endif
+}
+
+void PerfCounters::Enable() {
+#ifdef __linux__
+  for (int fd : fds_) {
+    if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+  }
+#endif
+}
+
+void PerfCounters::Disable() {
+#ifdef __linux__
+  for (int fd : fds_) {
+    if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+  }
+#endif
+}
+
+void PerfCounters::Report(benchmark::State &state, double ops) {
+#ifdef __linux__
+  if (!active_ || ops <= 0) return;
+  double values[kEvents] = {};
+  for (int i = 0; i < kEvents; ++i) {
+    std::uint64_t data[3];  // value, time enabled, time running
+    if (fds_[i] < 0 || read(fds_[i], data, sizeof(data)) != sizeof(data) ||
+        data[2] == 0) {
+      values[i] = -1;
+      continue;
+    }
+    values[i] = double(data[0]) * double(data[1]) / double(data[2]);
+    state.counters[std::string(kEventTable[i].name) + "/op"] = values[i] / ops;
+  }
+  if (values[0] > 0 && values[1] >= 0) {
+    state.counters["ipc"] = values[1] / values[0];
+  }
+#else
+  (void)state;
+  (void)ops;
+#endif
+}
+
+PerfCounters *PerfCounters::Current() { return current; }
+
+void PerfCounters::SetCurrent(PerfCounters *counters) { current = counters; }
+
+PerfLoop::Iterator PerfLoop::begin() {
+  // The timer starts in state_.begin(); the counters right after it.
+  Iterator it(state_.begin(), this);
+  if (counters_.Active()) {
+    PerfCounters::SetCurrent(&counters_);
+    counters_.Enable();
+  }
+  return it;
+}
+
+void PerfLoop::Finish() {
+  if (finished_) return;
+  finished_ = true;
+  if (!counters_.Active()) return;
+  counters_.Disable();
+  PerfCounters::SetCurrent(nullptr);
+  counters_.Report(state_,
+                   double(state_.iterations()) * static_cast<double>(ops_));
+}
+}  // namespace s21_bench
@@ -0,0 +1,96 @@
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+// Hardware counters around the timed loop of a case, read through Linux
+// perf_event_open. Off unless the environment sets S21_PERF=1, e.g.
+//   S21_PERF=1 make bench BENCH_ARGS=--benchmark_filter=Tree
+// Each case then reports cycles, instructions, L1D/LLC/dTLB misses and
+// branch misses per operation plus IPC. Events the kernel or hypervisor
+// does not expose are skipped; elsewhere than Linux nothing is reported.
+namespace s21_bench {
+class PerfCounters {
+ public:
+  static constexpr int kEvents = 6;
+
+  // Opens the events when S21_PERF=1; stays inactive otherwise.
+  PerfCounters();
+  ~PerfCounters();
+  PerfCounters(const PerfCounters &) = delete;
+  PerfCounters &operator=(const PerfCounters &) = delete;
+
+  bool Active() const { return active_; }
+  void Enable();
+  void Disable();
+  // Adds "<event>/op" counters for `ops` operations in total.
+  void Report(benchmark::State &state, double ops);
+
+  // Counters of the loop running on this thread, if any.
+  static PerfCounters *Current();
+  static void SetCurrent(PerfCounters *counters);
+
+ private:
+  int fds_[kEvents];
+  bool active_ = false;
+};
+
+/// Drop-in for `state` in `for (auto _ : state)`: counts hardware events
+/// while the loop runs and reports them per operation, `ops` being the
+/// operations in one iteration.
+class PerfLoop {
+ public:
+  class Iterator {
+   public:
+    Iterator(benchmark::State::StateIterator it, PerfLoop *loop)
+        : it_(it), loop_(loop) {}
+    benchmark::State::StateIterator::Value operator*() const { return *it_; }
+    Iterator &operator++() {
+      ++it_;
+      return *this;
+    }
+    bool operator!=(const Iterator &other) const {
+      if (it_ != other.it_) return true;
+      loop_->Finish();
+      return false;
+    }
+
+   private:
+    benchmark::State::StateIterator it_;
+    PerfLoop *loop_;
+  };
+
+  PerfLoop(benchmark::State &state, std::int64_t ops)
+      : state_(state), ops_(ops) {}
+  ~PerfLoop() { Finish(); }
+
+  Iterator begin();
+  Iterator end() { return Iterator(state_.end(), this); }
+
+ private:
+  void Finish();
+
+  benchmark::State &state_;
+  std::int64_t ops_;
+  PerfCounters counters_;
+  bool finished_ = false;
+};
+
+inline PerfLoop Measured(benchmark::State &state, std::int64_t ops = 1) {
+  return PerfLoop(state, ops);
+}
+
+/// state.PauseTiming()/ResumeTiming() that also stop the hardware counters.
+inline void PauseTiming(benchmark::State &state) {
+  state.PauseTiming();
+  if (PerfCounters *counters = PerfCounters::Current()) counters->Disable();
+}
+inline void ResumeTiming(benchmark::State &state) {
+  if (PerfCounters *counters = PerfCounters::Current()) counters->Enable();
+  state.ResumeTiming();
+}
+}  // namespace s21_bench
+
+#endif  // PERF_COUNTERS_H
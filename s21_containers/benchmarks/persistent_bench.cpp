@@ -0,0 +1,134 @@
+#include "../setMap/persistent/s21_persistent_map.h"
+#include "../setMap/persistent/s21_persistent_set.h"
+#include "../setMap/set/s21_set.tpp"
+#include "bench_common.h"
+
+namespace {
+using s21_bench::Measured;
+using s21_bench::SetItems;
+using s21_bench::Values;
+
+template <class C>
+using Key = typename C::key_type;
+
+template <class T>
+s21::Set<T> BuiltSet(const std::vector<T> &keys) {
+  s21::Set<T> c;
+  for (const auto &key : keys) c.insert(key);
+  return c;
+}
+template <class T>
+s21::PersistentSet<T> BuiltPersistent(const std::vector<T> &keys) {
+  s21::PersistentSet<T> c;
+  for (const auto &key : keys) c = c.insert(key);
+  return c;
+}
+
+// Publishing one change the way a snapshot-based service does today: deep
+// copy the current Set, then insert into the copy.
+template <class T>
+void BM_PublishCopySet(benchmark::State &state) {
+  const auto keys = Values<T>(state.range(0) + 1);
+  const s21::Set<T> current =
+      BuiltSet<T>(std::vector<T>(keys.begin(), keys.end() - 1));
+  for (auto _ : Measured(state)) {
+    s21::Set<T> next(current);
+    next.insert(keys.back());
+    benchmark::DoNotOptimize(&next);
+  }
+}
+
+// The same change as a new persistent version sharing all other nodes.
+template <class T>
+void BM_PublishPersistentSet(benchmark::State &state) {
+  const auto keys = Values<T>(state.range(0) + 1);
+  const s21::PersistentSet<T> current =
+      BuiltPersistent<T>(std::vector<T>(keys.begin(), keys.end() - 1));
+  for (auto _ : Measured(state)) {
+    s21::PersistentSet<T> next = current.insert(keys.back());
+    benchmark::DoNotOptimize(&next);
+  }
+}
+
+// A reader taking its own handle on the current version.
+template <class T>
+void BM_SnapshotPersistentSet(benchmark::State &state) {
+  const s21::PersistentSet<T> current =
+      BuiltPersistent<T>(Values<T>(state.range(0)));
+  for (auto _ : Measured(state)) {
+    s21::PersistentSet<T> snapshot = current;
+    benchmark::DoNotOptimize(&snapshot);
+  }
+}
+
+template <class T>
+void BM_PersistentSetBuild(benchmark::State &state) {
+  const auto keys = Values<T>(state.range(0));
+  for (auto _ : Measured(state, state.range(0))) {
+    benchmark::DoNotOptimize(BuiltPersistent<T>(keys).size());
+  }
+  SetItems(state, state.range(0));
+}
+
+template <class T>
+void BM_PersistentSetErase(benchmark::State &state) {
+  const auto keys = Values<T>(state.range(0));
+  const s21::PersistentSet<T> full = BuiltPersistent<T>(keys);
+  for (auto _ : Measured(state, state.range(0))) {
+    s21::PersistentSet<T> c = full;
+    for (const auto &key : keys) c = c.erase(key);
+    benchmark::DoNotOptimize(c.size());
+  }
+  SetItems(state, state.range(0));
+}
+
+template <class T>
+void BM_PersistentSetContains(benchmark::State &state) {
+  const auto keys = Values<T>(state.range(0));
+  const s21::PersistentSet<T> c = BuiltPersistent<T>(keys);
+  for (auto _ : Measured(state, state.range(0))) {
+    std::size_t found = 0;
+    for (const auto &key : keys) found += c.contains(key);
+    benchmark::DoNotOptimize(found);
+  }
+  SetItems(state, state.range(0));
+}
+
+template <class T>
+void BM_PersistentSetIterate(benchmark::State &state) {
+  const s21::PersistentSet<T> c =
+      BuiltPersistent<T>(Values<T>(state.range(0)));
+  for (auto _ : Measured(state, state.range(0))) {
+    std::size_t count = 0;
+    for (auto it = c.begin(); it != c.end(); ++it) ++count;
+    benchmark::DoNotOptimize(count);
+  }
+  SetItems(state, state.range(0));
+}
+
+template <class T>
+void BM_PersistentMapAssign(benchmark::State &state) {
+  const auto keys = Values<T>(state.range(0));
+  s21::PersistentMap<T, T> c;
+  for (const auto &key : keys) c = c.insert(key, key);
+  for (auto _ : Measured(state, state.range(0))) {
+    for (const auto &key : keys) c = c.insert_or_assign(key, key);
+    benchmark::DoNotOptimize(c.size());
+  }
+  SetItems(state, state.range(0));
+}
+}  // namespace
+
+#define S21_PERSISTENT_BENCH(fn)                                 \
+  BENCHMARK_TEMPLATE(fn, int)->Apply(s21_bench::Sizes<int>);     \
+  BENCHMARK_TEMPLATE(fn, std::string)                            \
+      ->Apply(s21_bench::Sizes<std::string>)
+
+S21_PERSISTENT_BENCH(BM_PublishCopySet);
+S21_PERSISTENT_BENCH(BM_PublishPersistentSet);
+S21_PERSISTENT_BENCH(BM_SnapshotPersistentSet);
+S21_PERSISTENT_BENCH(BM_PersistentSetBuild);
+S21_PERSISTENT_BENCH(BM_PersistentSetErase);
+S21_PERSISTENT_BENCH(BM_PersistentSetContains);
+S21_PERSISTENT_BENCH(BM_PersistentSetIterate);
+S21_PERSISTENT_BENCH(BM_PersistentMapAssign);
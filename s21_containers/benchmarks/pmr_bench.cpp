@@ -0,0 +1,57 @@
+#include <benchmark/benchmark.h>
+
+#include "../list/list.h"
+#include "../memory/memory_resource.h"
+#include "../setMap/set/s21_set.tpp"
+#include "../vector/vector.h"
+
+namespace {
+// One simulated request: build a batch of small, short-lived containers and
+// throw them all away. range(0) is the number of containers of each kind.
+template <class Vec, class Lst, class St, class Alloc>
+void Request(int containers, const Alloc &alloc) {
+  for (int c = 0; c < containers; ++c) {
+    Vec v(alloc);
+    Lst l(alloc);
+    St s(alloc);
+    for (int i = 0; i < 16; ++i) {
+      v.push_back(i);
+      l.push_back(i);
+      s.insert((i * 7) % 16);
+    }
+    benchmark::DoNotOptimize(v.data());
+    benchmark::DoNotOptimize(s.size());
+  }
+}
+
+void BM_RequestDefault(benchmark::State &state) {
+  for (auto _ : state) {
+    Request<s21::Vector<int>, s21::List<int>, s21::Set<int>>(
+        state.range(0), std::allocator<int>());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_RequestMonotonic(benchmark::State &state) {
+  alignas(std::max_align_t) static unsigned char buffer[1 << 20];
+  for (auto _ : state) {
+    s21::pmr::MonotonicBufferResource resource(buffer, sizeof(buffer));
+    Request<s21::pmr::Vector<int>, s21::pmr::List<int>, s21::pmr::Set<int>>(
+        state.range(0), s21::pmr::PolymorphicAllocator<int>(&resource));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_RequestPool(benchmark::State &state) {
+  s21::pmr::UnsynchronizedPoolResource resource;
+  for (auto _ : state) {
+    Request<s21::pmr::Vector<int>, s21::pmr::List<int>, s21::pmr::Set<int>>(
+        state.range(0), s21::pmr::PolymorphicAllocator<int>(&resource));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+}  // namespace
+
+BENCHMARK(BM_RequestDefault)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(BM_RequestMonotonic)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(BM_RequestPool)->RangeMultiplier(8)->Range(8, 512);
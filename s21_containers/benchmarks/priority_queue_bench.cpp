@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../priorityQueue/indexed_priority_queue.h"
+
+namespace {
+// Synthetic sparse digraph in CSR form: every vertex gets `degree` random
+// outgoing edges with weights in [1, 1000].
+struct Graph {
+  std::vector<std::size_t> offsets;
+  std::vector<std::size_t> targets;
+  std::vector<std::int64_t> weights;
+
+  Graph(std::size_t vertices, std::size_t degree) {
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<std::size_t> vertex(0, vertices - 1);
+    std::uniform_int_distribution<std::int64_t> weight(1, 1000);
+    offsets.reserve(vertices + 1);
+    for (std::size_t v = 0; v < vertices; ++v) {
+      offsets.push_back(targets.size());
+      for (std::size_t e = 0; e < degree; ++e) {
+        targets.push_back(vertex(rng));
+        weights.push_back(weight(rng));
+      }
+    }
+    offsets.push_back(targets.size());
+  }
+
+  std::size_t size() const { return offsets.size() - 1; }
+};
+
+const std::int64_t kInf = std::numeric_limits<std::int64_t>::max();
+
+// Dijkstra with decrease_key: every vertex is queued at most once.
+std::int64_t DijkstraIndexed(const Graph &g) {
+  std::vector<std::int64_t> dist(g.size(), kInf);
+  std::vector<std::size_t> handle(g.size(), 0);
+  std::vector<bool> queued(g.size(), false);
+  std::vector<std::size_t> vertex_of;
+  s21::IndexedPriorityQueue<std::int64_t> queue;
+  vertex_of.reserve(g.size());
+
+  dist[0] = 0;
+  handle[0] = queue.push(0);
+  vertex_of.push_back(0);
+  queued[0] = true;
+  while (!queue.empty()) {
+    std::size_t u = vertex_of[queue.top_handle()];
+    queue.pop();
+    queued[u] = false;
+    for (std::size_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e) {
+      std::size_t v = g.targets[e];
+      std::int64_t candidate = dist[u] + g.weights[e];
+      if (candidate >= dist[v]) continue;
+      dist[v] = candidate;
+      if (queued[v]) {
+        queue.decrease_key(handle[v], candidate);
+      } else {
+        handle[v] = queue.push(candidate);
+        if (handle[v] >= vertex_of.size()) vertex_of.resize(handle[v] + 1);
+        vertex_of[handle[v]] = v;
+        queued[v] = true;
+      }
+    }
+  }
+  return dist[g.size() - 1];
+}
+
+// Baseline: std::priority_queue with lazy deletion of stale entries.
+std::int64_t DijkstraLazy(const Graph &g) {
+  using Entry = std::pair<std::int64_t, std::size_t>;
+  std::vector<std::int64_t> dist(g.size(), kInf);
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+
+  dist[0] = 0;
+  queue.push({0, 0});
+  while (!queue.empty()) {
+    Entry top = queue.top();
+    queue.pop();
+    std::size_t u = top.second;
+    if (top.first != dist[u]) continue;
+    for (std::size_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e) {
+      std::size_t v = g.targets[e];
+      std::int64_t candidate = dist[u] + g.weights[e];
+      if (candidate >= dist[v]) continue;
+      dist[v] = candidate;
+      queue.push({candidate, v});
+    }
+  }
+  return dist[g.size() - 1];
+}
+
+void BM_DijkstraIndexedPriorityQueue(benchmark::State &state) {
+  Graph g(static_cast<std::size_t>(state.range(0)), 8);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(DijkstraIndexed(g));
+  }
+  state.SetItemsProcessed(state.iterations() * g.targets.size());
+}
+
+void BM_DijkstraStdPriorityQueue(benchmark::State &state) {
+  Graph g(static_cast<std::size_t>(state.range(0)), 8);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(DijkstraLazy(g));
+  }
+  state.SetItemsProcessed(state.iterations() * g.targets.size());
+}
+}  // namespace
+
+BENCHMARK(BM_DijkstraIndexedPriorityQueue)
+    ->RangeMultiplier(10)
+    ->Range(1000, 1000000);
+BENCHMARK(BM_DijkstraStdPriorityQueue)
+    ->RangeMultiplier(10)
+    ->Range(1000, 1000000);
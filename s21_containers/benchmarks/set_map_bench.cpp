@@ -0,0 +1,496 @@
+#include <functional>
+#include <iterator>
+#include <map>
+#include <set>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "../setMap/map/s21_map.tpp"
+#include "../setMap/set/s21_set.tpp"
+#include "bench_common.h"
+
+namespace {
+using s21_bench::Contains;
+using s21_bench::Measured;
+using s21_bench::PauseTiming;
+using s21_bench::ResumeTiming;
+using s21_bench::SetItems;
+using s21_bench::Values;
+using s21_bench::Weight;
+
+// Maps use the same type for keys and values so both fit S21_BENCH_PAIR.
+template <class T>
+using S21Map = s21::Map<T, T>;
+template <class T>
+using StdMap = std::map<T, T>;
+
+template <class C>
+using Key = typename C::key_type;
+
+// Inserts each key; for maps the key doubles as the mapped value.
+template <class T, class... Rest>
+void Add(s21::Set<T, Rest...> &c, const T &key) {
+  c.insert(key);
+}
+template <class T, class... Rest>
+void Add(std::set<T, Rest...> &c, const T &key) {
+  c.insert(key);
+}
+template <class T>
+void Add(S21Map<T> &c, const T &key) {
+  c.insert({key, key});
+}
+template <class T>
+void Add(StdMap<T> &c, const T &key) {
+  c.insert({key, key});
+}
+
+template <class C>
+C Built(const std::vector<Key<C>> &keys) {
+  C c;
+  for (const auto &key : keys) Add(c, key);
+  return c;
+}
+
+template <class C>
+void BM_TreeInsert(benchmark::State &state) {
+  const auto keys = Values<Key<C>>(state.range(0));
+  for (auto _ : Measured(state, state.range(0))) {
+    C c;
+    for (const auto &key : keys) Add(c, key);
+    benchmark::DoNotOptimize(&c);
+  }
+  SetItems(state, state.range(0));
+}
+
+// Every key is already present: the lookup half of insert.
+template <class C>
+void BM_TreeInsertExisting(benchmark::State &state) {
+  const auto keys = Values<Key<C>>(state.range(0));
+  C c = Built<C>(keys);
+  for (auto _ : Measured(state, state.range(0))) {
+    for (const auto &key : keys) Add(c, key);
+    benchmark::DoNotOptimize(&c);
+  }
+  SetItems(state, state.range(0));
+}
+
+template <class C>
+void BM_TreeFind(benchmark::State &state) {
+  const auto keys = Values<Key<C>>(state.range(0));
+  C c = Built<C>(keys);
+  for (auto _ : Measured(state, state.range(0))) {
+    for (const auto &key : keys) benchmark::DoNotOptimize(c.find(key));
+  }
+  SetItems(state, state.range(0));
+}
+
+// Sets of std::string searched with std::string_view keys, as parsers and
+// protocol handlers hold them. std::less<> compares the view in place;
+// std::less<std::string> needs a std::string built per lookup.
+template <class T>
+using S21ViewSet = s21::Set<T, std::less<>>;
+template <class T>
+using StdViewSet = std::set<T, std::less<>>;
+
+template <class C>
+auto FindView(C &c, std::string_view key) {
+  if constexpr (std::is_same_v<typename C::key_compare, std::less<>>) {
+    return c.find(key);
+  } else {
+    return c.find(std::string(key));
+  }
+}
+
+template <class C>
+void BM_SetFindView(benchmark::State &state) {
+  const auto keys = Values<std::string>(state.range(0));
+  C c = Built<C>(keys);
+  for (auto _ : Measured(state, state.range(0))) {
+    for (const auto &key : keys) {
+      benchmark::DoNotOptimize(FindView(c, std::string_view(key)));
+    }
+  }
+  SetItems(state, state.range(0));
+}
+
+// Narrow window for range scans: far below the smallest size swept.
+constexpr std::size_t kScanWidth = 16;
+
+template <class T>
+std::size_t Scan(s21::Set<T> &c, const T &lo, const T &hi) {
+  std::size_t sum = 0;
+  for (const T &key : c.range(lo, hi)) sum += Weight(key);
+  return sum;
+}
+template <class T>
+std::size_t Scan(std::set<T> &c, const T &lo, const T &hi) {
+  std::size_t sum = 0;
+  for (auto it = c.lower_bound(lo), last = c.lower_bound(hi); it != last;
+       ++it) {
+    sum += Weight(*it);
+  }
+  return sum;
+}
+
+// Visits kScanWidth consecutive keys starting at a pseudo-random one: one
+// descent plus a short in-order walk, independent of the tree size.
+template <class C>
+void BM_SetRangeScan(benchmark::State &state) {
+  const auto sorted = Values<Key<C>>(state.range(0), true);
+  C c = Built<C>(Values<Key<C>>(state.range(0)));
+  const std::size_t windows = sorted.size() - kScanWidth;
+  std::size_t i = 0;
+  for (auto _ : Measured(state, kScanWidth)) {
+    i = (i + 7919) % windows;
+    benchmark::DoNotOptimize(Scan(c, sorted[i], sorted[i + kScanWidth]));
+  }
+  SetItems(state, kScanWidth);
+}
+
+template <class T>
+std::size_t Count(s21::Set<T> &c, const T &lo, const T &hi) {
+  return c.count_range(lo, hi);
+}
+template <class T>
+std::size_t Count(std::set<T> &c, const T &lo, const T &hi) {
+  return std::distance(c.lower_bound(lo), c.lower_bound(hi));
+}
+
+// Counts windows of half the keys: two descents over subtree sizes for
+// s21::Set, a walk over n/2 nodes for std::set.
+template <class C>
+void BM_SetCountRange(benchmark::State &state) {
+  const auto sorted = Values<Key<C>>(state.range(0), true);
+  C c = Built<C>(Values<Key<C>>(state.range(0)));
+  const std::size_t width = sorted.size() / 2;
+  std::size_t i = 0;
+  for (auto _ : Measured(state)) {
+    i = (i + 7919) % width;
+    benchmark::DoNotOptimize(Count(c, sorted[i], sorted[i + width]));
+  }
+}
+
+// Keys sharing a 64-character prefix: every comparison walks past it, so
+// the cost of insert and erase follows the comparisons made per level.
+std::vector<std::string> Paths(std::size_t n) {
+  const std::string prefix = "/var/lib/containers/storage/overlay/" +
+                             std::string(28, 'x') + "/";
+  std::vector<std::string> paths;
+  paths.reserve(n);
+  for (std::size_t i : s21_bench::Shuffled(n)) {
+    paths.push_back(prefix + std::to_string(i));
+  }
+  return paths;
+}
+
+// Inserts every path, re-inserts them all, then erases them by key.
+template <class C>
+void BM_SetPathChurn(benchmark::State &state) {
+  const auto paths = Paths(state.range(0));
+  for (auto _ : Measured(state, 3 * state.range(0))) {
+    C c;
+    for (const auto &path : paths) c.insert(path);
+    for (const auto &path : paths) c.insert(path);
+    for (const auto &path : paths) c.erase(path);
+    benchmark::DoNotOptimize(&c);
+  }
+  SetItems(state, 3 * state.range(0));
+}
+
+template <class C>
+void BM_TreeContains(benchmark::State &state) {
+  const auto keys = Values<Key<C>>(state.range(0));
+  C c = Built<C>(keys);
+  for (auto _ : Measured(state, state.range(0))) {
+    std::size_t found = 0;
+    for (const auto &key : keys) found += Contains(c, key);
+    benchmark::DoNotOptimize(found);
+  }
+  SetItems(state, state.range(0));
+}
+
+// Erases from begin() until empty.
+template <class C>
+void BM_TreeErase(benchmark::State &state) {
+  const auto keys = Values<Key<C>>(state.range(0));
+  for (auto _ : Measured(state, state.range(0))) {
+    PauseTiming(state);
+    C c = Built<C>(keys);
+    ResumeTiming(state);
+    while (!c.empty()) c.erase(c.begin());
+    benchmark::DoNotOptimize(&c);
+  }
+  SetItems(state, state.range(0));
+}
+
+template <class C>
+void BM_TreeIterate(benchmark::State &state) {
+  C c = Built<C>(Values<Key<C>>(state.range(0)));
+  for (auto _ : Measured(state, state.range(0))) {
+    std::size_t count = 0;
+    for (auto it = c.begin(); it != c.end(); ++it) ++count;
+    benchmark::DoNotOptimize(count);
+  }
+  SetItems(state, state.range(0));
+}
+
+template <class C>
+void BM_TreeCopy(benchmark::State &state) {
+  const C source = Built<C>(Values<Key<C>>(state.range(0)));
+  for (auto _ : Measured(state, state.range(0))) {
+    C copy(source);
+    benchmark::DoNotOptimize(&copy);
+  }
+  SetItems(state, state.range(0));
+}
+
+// Move construction followed by move assignment back into the source.
+template <class C>
+void BM_TreeMove(benchmark::State &state) {
+  C source = Built<C>(Values<Key<C>>(state.range(0)));
+  for (auto _ : Measured(state)) {
+    C moved(std::move(source));
+    source = std::move(moved);
+    benchmark::DoNotOptimize(&source);
+  }
+}
+
+template <class C>
+void BM_TreeClear(benchmark::State &state) {
+  const auto keys = Values<Key<C>>(state.range(0));
+  for (auto _ : Measured(state, state.range(0))) {
+    PauseTiming(state);
+    C c = Built<C>(keys);
+    ResumeTiming(state);
+    c.clear();
+    benchmark::DoNotOptimize(&c);
+  }
+  SetItems(state, state.range(0));
+}
+
+template <class C>
+void BM_TreeSwap(benchmark::State &state) {
+  C a = Built<C>(Values<Key<C>>(state.range(0)));
+  C b;
+  for (auto _ : Measured(state)) {
+    a.swap(b);
+    benchmark::DoNotOptimize(&a);
+  }
+}
+
+// Merges two disjoint trees of n/2 keys each.
+template <class C>
+void BM_TreeMerge(benchmark::State &state) {
+  const auto keys = Values<Key<C>>(state.range(0));
+  const std::vector<Key<C>> left(keys.begin(), keys.begin() + keys.size() / 2);
+  const std::vector<Key<C>> right(keys.begin() + keys.size() / 2, keys.end());
+  for (auto _ : Measured(state, state.range(0) / 2)) {
+    PauseTiming(state);
+    C a = Built<C>(left);
+    C b = Built<C>(right);
+    ResumeTiming(state);
+    a.merge(b);
+    benchmark::DoNotOptimize(&a);
+  }
+  SetItems(state, state.range(0) / 2);
+}
+
+template <class C>
+void BM_TreeCapacity(benchmark::State &state) {
+  C c = Built<C>(Values<Key<C>>(state.range(0)));
+  for (auto _ : Measured(state)) {
+    benchmark::DoNotOptimize(c.size() + c.empty() + c.max_size());
+  }
+}
+
+template <class C>
+void BM_MapAt(benchmark::State &state) {
+  const auto keys = Values<Key<C>>(state.range(0));
+  C c = Built<C>(keys);
+  for (auto _ : Measured(state, state.range(0))) {
+    std::size_t sum = 0;
+    for (const auto &key : keys) sum += Weight(c.at(key));
+    benchmark::DoNotOptimize(sum);
+  }
+  SetItems(state, state.range(0));
+}
+
+template <class C>
+void BM_MapSubscript(benchmark::State &state) {
+  const auto keys = Values<Key<C>>(state.range(0));
+  C c = Built<C>(keys);
+  for (auto _ : Measured(state, state.range(0))) {
+    std::size_t sum = 0;
+    for (const auto &key : keys) sum += Weight(c[key]);
+    benchmark::DoNotOptimize(sum);
+  }
+  SetItems(state, state.range(0));
+}
+
+// Overwrites every existing key.
+template <class C>
+void BM_MapInsertOrAssign(benchmark::State &state) {
+  const auto keys = Values<Key<C>>(state.range(0));
+  C c = Built<C>(keys);
+  for (auto _ : Measured(state, state.range(0))) {
+    for (const auto &key : keys) c.insert_or_assign(key, key);
+    benchmark::DoNotOptimize(&c);
+  }
+  SetItems(state, state.range(0));
+}
+
+// Moving elements between maps, as when rebalancing shards: through node
+// handles, which relink the node, or by copying and erasing each element.
+struct ByHandle {
+  template <class M, class K>
+  static void Move(M &from, M &to, const K &key) {
+    to.insert(from.extract(key));
+  }
+};
+struct ByCopy {
+  template <class M, class K>
+  static void Move(M &from, M &to, const K &key) {
+    auto it = from.find(key);
+    to.insert(*it);
+    from.erase(it);
+  }
+};
+
+// Every key to the other map and back.
+template <class C, class How>
+void BM_MapTransfer(benchmark::State &state) {
+  const auto keys = Values<Key<C>>(state.range(0));
+  C a = Built<C>(keys);
+  C b;
+  for (auto _ : Measured(state, 2 * state.range(0))) {
+    for (const auto &key : keys) How::Move(a, b, key);
+    for (const auto &key : keys) How::Move(b, a, key);
+    benchmark::DoNotOptimize(&a);
+  }
+  SetItems(state, 2 * state.range(0));
+}
+
+// Nightly expiry of a cache: about 30% of the keys, spread over the whole
+// key order.
+template <class T>
+bool Expired(const T &key) {
+  return std::hash<T>()(key) % 10 < 3;
+}
+template <class T, class U>
+bool Expired(const std::pair<const T, U> &item) {
+  return Expired(item.first);
+}
+
+struct ByEraseIf {
+  template <class C>
+  static void Expire(C &c) {
+    c.erase_if([](const auto &x) { return Expired(x); });
+  }
+};
+struct ByLoop {
+  template <class C>
+  static void Expire(C &c) {
+    for (auto it = c.begin(); it != c.end();) {
+      if (Expired(*it)) {
+        c.erase(it++);
+      } else {
+        ++it;
+      }
+    }
+  }
+};
+
+template <class C, class How>
+void BM_TreeExpire(benchmark::State &state) {
+  const auto keys = Values<Key<C>>(state.range(0));
+  for (auto _ : Measured(state, state.range(0))) {
+    PauseTiming(state);
+    C c = Built<C>(keys);
+    ResumeTiming(state);
+    How::Expire(c);
+    benchmark::DoNotOptimize(&c);
+  }
+  SetItems(state, state.range(0));
+}
+
+// Erases the middle half of the keys with one erase(first, last).
+template <class C>
+void BM_TreeEraseRange(benchmark::State &state) {
+  const auto keys = Values<Key<C>>(state.range(0));
+  for (auto _ : Measured(state, state.range(0) / 2)) {
+    PauseTiming(state);
+    C c = Built<C>(keys);
+    auto first = c.begin();
+    for (std::size_t i = 0; i < keys.size() / 4; ++i) ++first;
+    auto last = first;
+    for (std::size_t i = 0; i < keys.size() / 2; ++i) ++last;
+    ResumeTiming(state);
+    c.erase(first, last);
+    benchmark::DoNotOptimize(&c);
+  }
+  SetItems(state, state.range(0) / 2);
+}
+}  // namespace
+
+#define S21_SET_BENCH(fn) \
+  S21_BENCH_PAIR(fn, s21::Set, std::set, s21_bench::Sizes)
+#define S21_MAP_BENCH(fn) \
+  S21_BENCH_PAIR(fn, S21Map, StdMap, s21_bench::Sizes)
+#define S21_TREE_BENCH(fn) \
+  S21_SET_BENCH(fn);       \
+  S21_MAP_BENCH(fn)
+
+S21_TREE_BENCH(BM_TreeInsert);
+S21_TREE_BENCH(BM_TreeInsertExisting);
+S21_TREE_BENCH(BM_TreeFind);
+S21_SET_BENCH(BM_SetRangeScan);
+S21_SET_BENCH(BM_SetCountRange);
+S21_TREE_BENCH(BM_TreeContains);
+S21_TREE_BENCH(BM_TreeErase);
+S21_TREE_BENCH(BM_TreeIterate);
+S21_TREE_BENCH(BM_TreeCopy);
+S21_TREE_BENCH(BM_TreeMove);
+S21_TREE_BENCH(BM_TreeClear);
+S21_TREE_BENCH(BM_TreeEraseRange);
+S21_TREE_BENCH(BM_TreeSwap);
+S21_TREE_BENCH(BM_TreeMerge);
+S21_TREE_BENCH(BM_TreeCapacity);
+S21_MAP_BENCH(BM_MapAt);
+S21_MAP_BENCH(BM_MapSubscript);
+S21_MAP_BENCH(BM_MapInsertOrAssign);
+BENCHMARK_TEMPLATE(BM_SetFindView, s21::Set<std::string>)
+    ->Apply(s21_bench::Sizes<std::string>);
+BENCHMARK_TEMPLATE(BM_SetFindView, S21ViewSet<std::string>)
+    ->Apply(s21_bench::Sizes<std::string>);
+BENCHMARK_TEMPLATE(BM_SetFindView, std::set<std::string>)
+    ->Apply(s21_bench::Sizes<std::string>);
+BENCHMARK_TEMPLATE(BM_SetFindView, StdViewSet<std::string>)
+    ->Apply(s21_bench::Sizes<std::string>);
+BENCHMARK_TEMPLATE(BM_SetPathChurn, s21::Set<std::string>)
+    ->Apply(s21_bench::Sizes<std::string>);
+BENCHMARK_TEMPLATE(BM_SetPathChurn, std::set<std::string>)
+    ->Apply(s21_bench::Sizes<std::string>);
+BENCHMARK_TEMPLATE(BM_MapTransfer, S21Map<int>, ByHandle)
+    ->Apply(s21_bench::Sizes<int>);
+BENCHMARK_TEMPLATE(BM_MapTransfer, S21Map<int>, ByCopy)
+    ->Apply(s21_bench::Sizes<int>);
+BENCHMARK_TEMPLATE(BM_MapTransfer, StdMap<int>, ByHandle)
+    ->Apply(s21_bench::Sizes<int>);
+BENCHMARK_TEMPLATE(BM_MapTransfer, S21Map<std::string>, ByHandle)
+    ->Apply(s21_bench::Sizes<std::string>);
+BENCHMARK_TEMPLATE(BM_MapTransfer, S21Map<std::string>, ByCopy)
+    ->Apply(s21_bench::Sizes<std::string>);
+BENCHMARK_TEMPLATE(BM_TreeExpire, s21::Set<int>, ByEraseIf)
+    ->Apply(s21_bench::Sizes<int>);
+BENCHMARK_TEMPLATE(BM_TreeExpire, s21::Set<int>, ByLoop)
+    ->Apply(s21_bench::Sizes<int>);
+BENCHMARK_TEMPLATE(BM_TreeExpire, std::set<int>, ByLoop)
+    ->Apply(s21_bench::Sizes<int>);
+BENCHMARK_TEMPLATE(BM_TreeExpire, S21Map<std::string>, ByEraseIf)
+    ->Apply(s21_bench::Sizes<std::string>);
+BENCHMARK_TEMPLATE(BM_TreeExpire, S21Map<std::string>, ByLoop)
+    ->Apply(s21_bench::Sizes<std::string>);
+BENCHMARK_TEMPLATE(BM_TreeExpire, StdMap<std::string>, ByLoop)
+    ->Apply(s21_bench::Sizes<std::string>);
@@ -0,0 +1,62 @@
+#include "../setMap/concurrent/s21_sharded_map.h"
+#include "bench_common.h"
+
+namespace {
+using s21_bench::Measured;
+using s21_bench::SetItems;
+using s21_bench::Values;
+
+constexpr std::size_t kKeys = 1024;
+
+// One shard is a single Map behind one lock, the baseline.
+template <std::size_t Shards>
+using Counters = s21::ShardedMap<int, int, Shards>;
+
+template <class M>
+M &Shared() {
+  static M *map = [] {
+    M *built = new M;
+    for (int key : Values<int>(kKeys, true)) built->insert(key, 0);
+    return built;
+  }();
+  return *map;
+}
+
+// Every thread bumps counters under random keys.
+template <class M>
+void BM_ShardedCounters(benchmark::State &state) {
+  M &map = Shared<M>();
+  const auto keys = Values<int>(kKeys);
+  std::size_t i = state.thread_index() * 7919;
+  for (auto _ : Measured(state)) {
+    map.update(keys[++i % kKeys], [](int &count) { ++count; });
+  }
+  SetItems(state, 1);
+}
+
+// Sums every shard on the thread pool.
+template <class M>
+void BM_ShardedForEach(benchmark::State &state) {
+  M &map = Shared<M>();
+  for (auto _ : Measured(state, kKeys)) {
+    std::atomic<long> sum{0};
+    map.for_each_shard([&sum](s21::Map<int, int> &shard, std::size_t) {
+      long local = 0;
+      for (const auto &item : shard) local += item.second;
+      sum += local;
+    });
+    benchmark::DoNotOptimize(sum.load());
+  }
+  SetItems(state, kKeys);
+}
+}  // namespace
+
+#define S21_SHARDED_MAP_BENCH(shards)                                   \
+  BENCHMARK_TEMPLATE(BM_ShardedCounters, Counters<shards>)              \
+      ->ThreadRange(1, 64)                                              \
+      ->UseRealTime();                                                  \
+  BENCHMARK_TEMPLATE(BM_ShardedForEach, Counters<shards>)->UseRealTime()
+
+S21_SHARDED_MAP_BENCH(1);
+S21_SHARDED_MAP_BENCH(16);
+S21_SHARDED_MAP_BENCH(64);
@@ -0,0 +1,151 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+
+#include "../simd/simd.h"
+
+namespace {
+// Fills v with n values that never contain the searched needle, so find and
+// count always scan the whole range.
+template <class T>
+s21::Vector<T> MakeData(std::size_t n) {
+  s21::Vector<T> v(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    v[i] = static_cast<T>((i * 7919) % 1000);
+  }
+  return v;
+}
+
+template <class T>
+void BM_FindScalar(benchmark::State &state) {
+  s21::Vector<T> v = MakeData<T>(state.range(0));
+  const T *first = v.data();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        s21::simd::scalar::find(first, first + v.size(), static_cast<T>(-1)));
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(T));
+}
+
+template <class T>
+void BM_FindSimd(benchmark::State &state) {
+  s21::Vector<T> v = MakeData<T>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s21::simd::find(v, static_cast<T>(-1)));
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(T));
+}
+
+template <class T>
+void BM_CountScalar(benchmark::State &state) {
+  s21::Vector<T> v = MakeData<T>(state.range(0));
+  const T *first = v.data();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        s21::simd::scalar::count(first, first + v.size(), static_cast<T>(7)));
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(T));
+}
+
+template <class T>
+void BM_CountSimd(benchmark::State &state) {
+  s21::Vector<T> v = MakeData<T>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s21::simd::count(v, static_cast<T>(7)));
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(T));
+}
+
+template <class T>
+void BM_MinElementScalar(benchmark::State &state) {
+  s21::Vector<T> v = MakeData<T>(state.range(0));
+  const T *first = v.data();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        s21::simd::scalar::min_element(first, first + v.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(T));
+}
+
+template <class T>
+void BM_MinElementSimd(benchmark::State &state) {
+  s21::Vector<T> v = MakeData<T>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s21::simd::min_element(v));
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(T));
+}
+
+template <class T>
+void BM_MaxElementScalar(benchmark::State &state) {
+  s21::Vector<T> v = MakeData<T>(state.range(0));
+  const T *first = v.data();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        s21::simd::scalar::max_element(first, first + v.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(T));
+}
+
+template <class T>
+void BM_MaxElementSimd(benchmark::State &state) {
+  s21::Vector<T> v = MakeData<T>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s21::simd::max_element(v));
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(T));
+}
+
+template <class T>
+void BM_AccumulateScalar(benchmark::State &state) {
+  s21::Vector<T> v = MakeData<T>(state.range(0));
+  const T *first = v.data();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        s21::simd::scalar::accumulate(first, first + v.size(), T()));
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(T));
+}
+
+template <class T>
+void BM_AccumulateSimd(benchmark::State &state) {
+  s21::Vector<T> v = MakeData<T>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s21::simd::accumulate(v, T()));
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(T));
+}
+
+template <class T>
+void BM_FillScalar(benchmark::State &state) {
+  s21::Vector<T> v(state.range(0));
+  for (auto _ : state) {
+    s21::simd::scalar::fill(v.data(), v.data() + v.size(), static_cast<T>(3));
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(T));
+}
+
+template <class T>
+void BM_FillSimd(benchmark::State &state) {
+  s21::Vector<T> v(state.range(0));
+  for (auto _ : state) {
+    s21::simd::fill(v, static_cast<T>(3));
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(T));
+}
+}  // namespace
+
+#define S21_SIMD_BENCH(name)                                            \
+  BENCHMARK_TEMPLATE(BM_##name##Scalar, int)->Range(1 << 10, 1 << 24);  \
+  BENCHMARK_TEMPLATE(BM_##name##Simd, int)->Range(1 << 10, 1 << 24);    \
+  BENCHMARK_TEMPLATE(BM_##name##Scalar, float)->Range(1 << 10, 1 << 24); \
+  BENCHMARK_TEMPLATE(BM_##name##Simd, float)->Range(1 << 10, 1 << 24)
+
+S21_SIMD_BENCH(Find);
+S21_SIMD_BENCH(Count);
+S21_SIMD_BENCH(MinElement);
+S21_SIMD_BENCH(MaxElement);
+S21_SIMD_BENCH(Accumulate);
+S21_SIMD_BENCH(Fill);
@@ -0,0 +1,62 @@
+#include <memory>
+#include <set>
+
+#include "../setMap/set/s21_set.tpp"
+#include "bench_common.h"
+
+namespace {
+using s21_bench::HugeRequested;
+using s21_bench::Measured;
+using s21_bench::PauseTiming;
+using s21_bench::ResumeTiming;
+using s21_bench::SetItems;
+
+// Copy and teardown of trees far past the caches. 50M int nodes take
+// about 3 GB per tree and the copy case holds two, so that size only runs
+// with S21_HUGE=1 in the environment.
+constexpr std::int64_t kHugeSize = 50000000;
+
+void HugeSizes(benchmark::internal::Benchmark *b) {
+  b->Arg(1000000)->Arg(s21_bench::kMaxSize);
+  if (HugeRequested()) b->Arg(kHugeSize);
+  b->Unit(benchmark::kMillisecond);
+}
+
+// Ascending inserts: the cheapest way to a balanced tree this size.
+template <class C>
+std::unique_ptr<C> Ascending(std::int64_t n) {
+  auto c = std::make_unique<C>();
+  for (std::int64_t i = 0; i < n; ++i) c->insert(static_cast<int>(i));
+  return c;
+}
+
+template <class C>
+void BM_BigTreeCopy(benchmark::State &state) {
+  const auto source = Ascending<C>(state.range(0));
+  for (auto _ : Measured(state, state.range(0))) {
+    auto copy = std::make_unique<C>(*source);
+    benchmark::DoNotOptimize(copy.get());
+    PauseTiming(state);
+    copy.reset();
+    ResumeTiming(state);
+  }
+  SetItems(state, state.range(0));
+}
+
+template <class C>
+void BM_BigTreeClear(benchmark::State &state) {
+  for (auto _ : Measured(state, state.range(0))) {
+    PauseTiming(state);
+    auto c = Ascending<C>(state.range(0));
+    ResumeTiming(state);
+    c->clear();
+    benchmark::DoNotOptimize(c.get());
+  }
+  SetItems(state, state.range(0));
+}
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_BigTreeCopy, s21::Set<int>)->Apply(HugeSizes);
+BENCHMARK_TEMPLATE(BM_BigTreeCopy, std::set<int>)->Apply(HugeSizes);
+BENCHMARK_TEMPLATE(BM_BigTreeClear, s21::Set<int>)->Apply(HugeSizes);
+BENCHMARK_TEMPLATE(BM_BigTreeClear, std::set<int>)->Apply(HugeSizes);
@@ -0,0 +1,243 @@
+#include <utility>
+#include <vector>
+
+#include "../vector/vector.h"
+#include "bench_common.h"
+
+namespace {
+using s21_bench::Filled;
+using s21_bench::Measured;
+using s21_bench::PauseTiming;
+using s21_bench::ResumeTiming;
+using s21_bench::SetItems;
+using s21_bench::Values;
+using s21_bench::Weight;
+
+template <class C>
+using Value = typename C::value_type;
+
+template <class C>
+void BM_VectorConstruct(benchmark::State &state) {
+  const std::size_t n = state.range(0);
+  for (auto _ : Measured(state, n)) {
+    C c(n);
+    benchmark::DoNotOptimize(c.data());
+  }
+  SetItems(state, n);
+}
+
+template <class C>
+void BM_VectorCopy(benchmark::State &state) {
+  const C source = Filled<C>(Values<Value<C>>(state.range(0)));
+  for (auto _ : Measured(state, state.range(0))) {
+    C copy(source);
+    benchmark::DoNotOptimize(copy.data());
+  }
+  SetItems(state, state.range(0));
+}
+
+// Move construction followed by move assignment back into the source.
+template <class C>
+void BM_VectorMove(benchmark::State &state) {
+  C source = Filled<C>(Values<Value<C>>(state.range(0)));
+  for (auto _ : Measured(state)) {
+    C moved(std::move(source));
+    source = std::move(moved);
+    benchmark::DoNotOptimize(source.data());
+  }
+}
+
+template <class C>
+void BM_VectorPushBack(benchmark::State &state) {
+  const auto values = Values<Value<C>>(state.range(0));
+  for (auto _ : Measured(state, state.range(0))) {
+    C c;
+    for (const auto &value : values) c.push_back(value);
+    benchmark::DoNotOptimize(c.data());
+  }
+  SetItems(state, state.range(0));
+}
+
+template <class C>
+void BM_VectorReservePushBack(benchmark::State &state) {
+  const auto values = Values<Value<C>>(state.range(0));
+  for (auto _ : Measured(state, state.range(0))) {
+    C c;
+    c.reserve(values.size());
+    for (const auto &value : values) c.push_back(value);
+    benchmark::DoNotOptimize(c.data());
+  }
+  SetItems(state, state.range(0));
+}
+
+// One push_back/pop_back pair on a vector holding n elements.
+template <class C>
+void BM_VectorPushPopBack(benchmark::State &state) {
+  C c = Filled<C>(Values<Value<C>>(state.range(0)));
+  const Value<C> value = s21_bench::MakeValue<Value<C>>(1);
+  for (auto _ : Measured(state)) {
+    c.push_back(value);
+    c.pop_back();
+  }
+  benchmark::DoNotOptimize(c.data());
+}
+
+template <class C>
+void BM_VectorPopBack(benchmark::State &state) {
+  const auto values = Values<Value<C>>(state.range(0));
+  for (auto _ : Measured(state, state.range(0))) {
+    PauseTiming(state);
+    C c = Filled<C>(values);
+    ResumeTiming(state);
+    while (!c.empty()) c.pop_back();
+  }
+  SetItems(state, state.range(0));
+}
+
+// Random-index reads through at().
+template <class C>
+void BM_VectorAt(benchmark::State &state) {
+  C c = Filled<C>(Values<Value<C>>(state.range(0)));
+  const auto order = s21_bench::Shuffled(state.range(0));
+  for (auto _ : Measured(state, state.range(0))) {
+    std::size_t sum = 0;
+    for (std::size_t i : order) sum += Weight(c.at(i));
+    benchmark::DoNotOptimize(sum);
+  }
+  SetItems(state, state.range(0));
+}
+
+template <class C>
+void BM_VectorSubscript(benchmark::State &state) {
+  C c = Filled<C>(Values<Value<C>>(state.range(0)));
+  const auto order = s21_bench::Shuffled(state.range(0));
+  for (auto _ : Measured(state, state.range(0))) {
+    std::size_t sum = 0;
+    for (std::size_t i : order) sum += Weight(c[i]);
+    benchmark::DoNotOptimize(sum);
+  }
+  SetItems(state, state.range(0));
+}
+
+template <class C>
+void BM_VectorFrontBack(benchmark::State &state) {
+  C c = Filled<C>(Values<Value<C>>(state.range(0)));
+  for (auto _ : Measured(state)) {
+    benchmark::DoNotOptimize(Weight(c.front()) + Weight(c.back()));
+  }
+}
+
+template <class C>
+void BM_VectorIterate(benchmark::State &state) {
+  C c = Filled<C>(Values<Value<C>>(state.range(0)));
+  for (auto _ : Measured(state, state.range(0))) {
+    std::size_t sum = 0;
+    for (const auto &value : c) sum += Weight(value);
+    benchmark::DoNotOptimize(sum);
+  }
+  SetItems(state, state.range(0));
+}
+
+template <class C>
+void BM_VectorData(benchmark::State &state) {
+  C c = Filled<C>(Values<Value<C>>(state.range(0)));
+  for (auto _ : Measured(state, state.range(0))) {
+    const auto *data = c.data();
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < c.size(); ++i) sum += Weight(data[i]);
+    benchmark::DoNotOptimize(sum);
+  }
+  SetItems(state, state.range(0));
+}
+
+// size/empty/capacity/max_size in one pass; all O(1).
+template <class C>
+void BM_VectorCapacity(benchmark::State &state) {
+  C c = Filled<C>(Values<Value<C>>(state.range(0)));
+  for (auto _ : Measured(state)) {
+    benchmark::DoNotOptimize(c.size() + c.empty() + c.capacity() +
+                             c.max_size());
+  }
+}
+
+// reserve(2n) then shrink_to_fit: two reallocations of n elements.
+template <class C>
+void BM_VectorReserveShrink(benchmark::State &state) {
+  C c = Filled<C>(Values<Value<C>>(state.range(0)));
+  for (auto _ : Measured(state, 2 * state.range(0))) {
+    c.reserve(2 * c.size());
+    c.shrink_to_fit();
+    benchmark::DoNotOptimize(c.data());
+  }
+  SetItems(state, 2 * state.range(0));
+}
+
+template <class C>
+void BM_VectorClear(benchmark::State &state) {
+  const auto values = Values<Value<C>>(state.range(0));
+  for (auto _ : Measured(state, state.range(0))) {
+    PauseTiming(state);
+    C c = Filled<C>(values);
+    ResumeTiming(state);
+    c.clear();
+    benchmark::DoNotOptimize(c.data());
+  }
+  SetItems(state, state.range(0));
+}
+
+// insert at begin() then erase it again: both shift all n elements.
+template <class C>
+void BM_VectorInsertEraseFront(benchmark::State &state) {
+  C c = Filled<C>(Values<Value<C>>(state.range(0)));
+  const Value<C> value = s21_bench::MakeValue<Value<C>>(1);
+  for (auto _ : Measured(state, state.range(0))) {
+    c.insert(c.begin(), value);
+    c.erase(c.begin());
+  }
+  benchmark::DoNotOptimize(c.data());
+  SetItems(state, state.range(0));
+}
+
+template <class C>
+void BM_VectorInsertEraseBack(benchmark::State &state) {
+  C c = Filled<C>(Values<Value<C>>(state.range(0)));
+  const Value<C> value = s21_bench::MakeValue<Value<C>>(1);
+  for (auto _ : Measured(state)) {
+    c.insert(c.end(), value);
+    c.erase(c.end() - 1);
+  }
+  benchmark::DoNotOptimize(c.data());
+}
+
+template <class C>
+void BM_VectorSwap(benchmark::State &state) {
+  C a = Filled<C>(Values<Value<C>>(state.range(0)));
+  C b;
+  for (auto _ : Measured(state)) {
+    a.swap(b);
+    benchmark::DoNotOptimize(a.data());
+  }
+}
+}  // namespace
+
+#define S21_VECTOR_BENCH(fn) \
+  S21_BENCH_PAIR(fn, s21::Vector, std::vector, s21_bench::Sizes)
+
+S21_VECTOR_BENCH(BM_VectorConstruct);
+S21_VECTOR_BENCH(BM_VectorCopy);
+S21_VECTOR_BENCH(BM_VectorMove);
+S21_VECTOR_BENCH(BM_VectorPushBack);
+S21_VECTOR_BENCH(BM_VectorReservePushBack);
+S21_VECTOR_BENCH(BM_VectorPushPopBack);
+S21_VECTOR_BENCH(BM_VectorPopBack);
+S21_VECTOR_BENCH(BM_VectorAt);
+S21_VECTOR_BENCH(BM_VectorSubscript);
+S21_VECTOR_BENCH(BM_VectorFrontBack);
+S21_VECTOR_BENCH(BM_VectorIterate);
+S21_VECTOR_BENCH(BM_VectorData);
+S21_VECTOR_BENCH(BM_VectorCapacity);
+S21_VECTOR_BENCH(BM_VectorReserveShrink);
+S21_VECTOR_BENCH(BM_VectorClear);
+S21_VECTOR_BENCH(BM_VectorInsertEraseFront);
+S21_VECTOR_BENCH(BM_VectorInsertEraseBack);
+S21_VECTOR_BENCH(BM_VectorSwap);
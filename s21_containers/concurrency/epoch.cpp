@@ -0,0 +1,176 @@
+#include "epoch.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace s21 {
+namespace epoch {
+namespace {
+constexpr std::uint64_t kActive = 1;
+constexpr std::size_t kCollectEvery = 64;
+
+// One slot per thread that has pinned. Slots are recycled when their
+// thread exits and never freed, so scans need nothing but the atomics.
+struct alignas(64) Slot {
+  // epoch << 1 | kActive while pinned, 0 otherwise.
+  std::atomic<std::uint64_t> state{0};
+  std::atomic<bool> owned{true};
+  std::size_t depth = 0;  // Guard nesting, touched only by the owner.
+  Slot *next = nullptr;
+};
+
+struct Retired {
+  void *p;
+  void (*reclaim)(void *);
+  std::uint64_t epoch;
+  Retired *next;
+};
+
+class Domain {
+ public:
+  std::uint64_t Epoch() const { return epoch_.load(); }
+
+  Slot *Acquire() {
+    for (Slot *slot = slots_.load(std::memory_order_acquire); slot;
+         slot = slot->next) {
+      bool owned = false;
+      if (!slot->owned.load(std::memory_order_relaxed) &&
+          slot->owned.compare_exchange_strong(owned, true,
+                                              std::memory_order_acquire)) {
+        return slot;
+      }
+    }
+    Slot *slot = new Slot;
+    slot->next = slots_.load(std::memory_order_relaxed);
+    while (!slots_.compare_exchange_weak(slot->next, slot,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed)) {
+    }
+    return slot;
+  }
+
+  void Pin(Slot &slot) {
+    slot.state.store(epoch_.load(std::memory_order_relaxed) << 1 | kActive,
+                     std::memory_order_relaxed);
+    // Orders the slot store before the reader's loads of shared pointers,
+    // pairing with the fences in TryAdvance and Retire.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+
+  // The epoch moves on once every pinned thread has seen the current one.
+  bool TryAdvance() {
+    std::uint64_t epoch = epoch_.load();
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (Slot *slot = slots_.load(std::memory_order_acquire); slot;
+         slot = slot->next) {
+      std::uint64_t state = slot->state.load(std::memory_order_acquire);
+      if ((state & kActive) && (state >> 1) != epoch) return false;
+    }
+    epoch_.compare_exchange_strong(epoch, epoch + 1);
+    return true;
+  }
+
+  void Retire(void *p, void (*reclaim)(void *)) {
+    bool due;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      // The caller unlinked p before this point; readers pinned at this
+      // epoch or earlier may still hold it.
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      retired_ = new Retired{p, reclaim, epoch_.load(), retired_};
+      due = pending_.fetch_add(1, std::memory_order_relaxed) %
+                kCollectEvery ==
+            kCollectEvery - 1;
+    }
+    if (due) Collect();
+  }
+
+  // Anything retired two epochs ago is unreachable: every reader pinned
+  // back then has unpinned since.
+  std::size_t Collect() {
+    Retired *ready = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      TryAdvance();
+      std::uint64_t safe = epoch_.load();
+      // Newest first, so the reclaimable ones form a suffix.
+      Retired **link = &retired_;
+      while (*link && (*link)->epoch + 2 > safe) link = &(*link)->next;
+      ready = *link;
+      *link = nullptr;
+    }
+    std::size_t count = 0;
+    while (ready) {
+      Retired *next = ready->next;
+      ready->reclaim(ready->p);
+      delete ready;
+      ready = next;
+      ++count;
+    }
+    pending_.fetch_sub(count, std::memory_order_relaxed);
+    return count;
+  }
+
+  std::size_t Pending() const {
+    return pending_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<std::uint64_t> epoch_{0};
+  std::atomic<Slot *> slots_{nullptr};
+  std::atomic<std::size_t> pending_{0};
+  std::mutex mutex_;
+  Retired *retired_ = nullptr;
+};
+
+// Never destroyed, so containers with static storage can still retire
+// during exit.
+Domain &Instance() {
+  static Domain *domain = new Domain;
+  return *domain;
+}
+
+struct ThreadSlot {
+  Slot *slot = nullptr;
+  ~ThreadSlot() {
+    if (slot) slot->owned.store(false, std::memory_order_release);
+  }
+};
+
+Slot &Local() {
+  thread_local ThreadSlot local;
+  if (!local.slot) local.slot = Instance().Acquire();
+  return *local.slot;
+}
+}  // namespace
+
+Guard::Guard() {
+  Slot &slot = Local();
+  if (slot.depth++ == 0) Instance().Pin(slot);
+}
+
+Guard::~Guard() {
+  Slot &slot = Local();
+  if (--slot.depth == 0) slot.state.store(0, std::memory_order_release);
+}
+
+void retire(void *p, void (*reclaim)(void *)) {
+  Instance().Retire(p, reclaim);
+}
+
+std::size_t collect() { return Instance().Collect(); }
+
+void synchronize() {
+  Domain &domain = Instance();
+  const std::uint64_t target = domain.Epoch() + 2;
+  while (domain.Epoch() < target) {
+    if (!domain.TryAdvance()) std::this_thread::yield();
+  }
+  domain.Collect();
+}
+
+std::size_t pending() { return Instance().Pending(); }
+}  // namespace epoch
+}  // namespace s21
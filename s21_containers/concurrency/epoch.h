@@ -0,0 +1,53 @@
+#ifndef EPOCH_H
+#define EPOCH_H
+
+#include <cstddef>
+
+namespace s21 {
+/// Epoch-based reclamation for lock-free readers. A reader pins the current
+/// epoch with a Guard for as long as it dereferences shared pointers; a
+/// writer that unlinks an object hands it to retire() instead of freeing
+/// it, and the object is reclaimed once every reader that could have seen
+/// it has unpinned. Pinning never blocks and never writes shared state
+/// other than the calling thread's own slot.
+///
+/// There is one process-wide domain, so a reader may hold a Guard across
+/// several containers that use it.
+namespace epoch {
+/// Pins the calling thread for its lifetime. Guards nest; only the
+/// outermost one pins and unpins. A copy pins again, so iterators can
+/// carry one, but a Guard and its copies belong to the thread that made
+/// them.
+class Guard {
+ public:
+  Guard();
+  Guard(const Guard &) : Guard() {}
+  ~Guard();
+  Guard &operator=(const Guard &) { return *this; }
+};
+
+/// Schedules reclaim(p) for after every Guard alive now has ended; p must
+/// already be unreachable for readers that pin later. May run earlier
+/// reclamations on the calling thread, but never waits for readers.
+void retire(void *p, void (*reclaim)(void *));
+
+template <class T>
+void retire(T *p) {
+  retire(static_cast<void *>(p),
+         [](void *q) { delete static_cast<T *>(q); });
+}
+
+/// Tries to advance the epoch and reclaims what is safe; returns the
+/// number of objects reclaimed. Non-blocking.
+std::size_t collect();
+
+/// Waits until everything retired before the call has been reclaimed.
+/// Must not be called under a Guard.
+void synchronize();
+
+/// Objects retired and not yet reclaimed.
+std::size_t pending();
+}  // namespace epoch
+}  // namespace s21
+
+#endif  // EPOCH_H
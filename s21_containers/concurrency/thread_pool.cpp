@@ -0,0 +1,93 @@
+#include "thread_pool.h"
+
+#include <exception>
+
+namespace s21 {
+struct ThreadPool::Job {
+  Job(std::size_t n, void (*call)(void *, std::size_t), void *fn)
+      : n(n), call(call), fn(fn) {}
+
+  std::size_t n;
+  void (*call)(void *, std::size_t);
+  void *fn;
+  // The rest is guarded by the pool's mutex.
+  std::size_t next = 0;
+  std::size_t running = 0;
+  std::exception_ptr error;
+  bool queued = false;
+  Job *link = nullptr;
+  std::condition_variable done;
+};
+
+ThreadPool::ThreadPool(std::size_t workers) : workers_(workers) {
+  for (std::size_t i = 0; i < workers; ++i) {
+    workers_[i] = std::thread([this] { Work(); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  for (std::size_t i = 0; i < workers_.size(); ++i) workers_[i].join();
+}
+
+ThreadPool &ThreadPool::global() {
+  static ThreadPool pool([] {
+    std::size_t threads = std::thread::hardware_concurrency();
+    return threads > 1 ? threads - 1 : 0;
+  }());
+  return pool;
+}
+
+void ThreadPool::Run(std::size_t n, void (*call)(void *, std::size_t),
+                     void *fn) {
+  if (n == 0) return;
+  Job job(n, call, fn);
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (n > 1 && !workers_.empty()) {
+    job.queued = true;
+    job.link = jobs_;
+    jobs_ = &job;
+    wake_.notify_all();
+  }
+  Drain(job, lock);
+  job.done.wait(lock, [&job] { return job.running == 0; });
+  if (job.error) std::rethrow_exception(job.error);
+}
+
+void ThreadPool::Drain(Job &job, std::unique_lock<std::mutex> &lock) {
+  while (job.next < job.n && !job.error) {
+    std::size_t i = job.next++;
+    ++job.running;
+    lock.unlock();
+    std::exception_ptr error;
+    try {
+      job.call(job.fn, i);
+    } catch (...) {
+      error = std::current_exception();
+    }
+    lock.lock();
+    --job.running;
+    if (error && !job.error) job.error = error;
+  }
+  if (job.queued) {
+    Job **link = &jobs_;
+    while (*link != &job) link = &(*link)->link;
+    *link = job.link;
+    job.queued = false;
+  }
+  if (job.running == 0) job.done.notify_all();
+}
+
+void ThreadPool::Work() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    wake_.wait(lock, [this] { return stop_ || jobs_; });
+    if (stop_) return;
+    Drain(*jobs_, lock);
+  }
+}
+}  // namespace s21
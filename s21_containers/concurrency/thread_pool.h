@@ -0,0 +1,58 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+#include "../vector/vector.h"
+
+namespace s21 {
+/// Fixed set of worker threads for data-parallel loops. parallel_for hands
+/// out indices one at a time to the workers and to the calling thread,
+/// which takes part instead of just waiting; so a loop started from inside
+/// another loop's body still finishes even when every worker is busy.
+class ThreadPool {
+ public:
+  /// `workers` threads besides the callers; 0 runs every loop inline.
+  explicit ThreadPool(std::size_t workers);
+  ~ThreadPool();
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  /// Threads a loop can run on: the workers plus the caller.
+  std::size_t concurrency() const { return workers_.size() + 1; }
+
+  /// Calls fn(i) for every i in [0, n) and returns once all calls have.
+  /// The first exception a call throws is rethrown here, after the others
+  /// have finished; indices not yet started are skipped.
+  template <class Fn>
+  void parallel_for(std::size_t n, Fn &&fn) {
+    using F = std::remove_reference_t<Fn>;
+    Run(n, [](void *f, std::size_t i) { (*static_cast<F *>(f))(i); },
+        const_cast<void *>(static_cast<const void *>(&fn)));
+  }
+
+  /// Shared pool with one worker per hardware thread besides the caller.
+  static ThreadPool &global();
+
+ private:
+  struct Job;
+
+  void Run(std::size_t n, void (*call)(void *, std::size_t), void *fn);
+  // Runs indices of `job` until none are left; called and returns with
+  // `lock` held.
+  void Drain(Job &job, std::unique_lock<std::mutex> &lock);
+  void Work();
+
+  Vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  Job *jobs_ = nullptr;  // Jobs with indices left to hand out.
+  bool stop_ = false;
+};
+}  // namespace s21
+
+#endif  // THREAD_POOL_H
@@ -3,26 +3,37 @@
 
 #include <cstddef>
 #include <iostream>
+#include <memory>
+#include <utility>
+
+#include "../memory/alloc_stats.h"
+#include "../memory/memory_resource.h"
 
 namespace s21 {
-template <typename T>
-class List {
+template <typename T, typename Allocator = std::allocator<T>>
+class List : private stats::Tracker<List<T, Allocator>> {
  public:
   /// List Member type
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T&;
   using const_reference = const T&;
   using size_type = std::size_t;
 
   /// List Functions
-  List();             // Default constructor
-  List(size_type n);  // Parameterized constructor
-  List(std::initializer_list<value_type> const&
-           items);      // Initializer list constructor
+  List();                                      // Default constructor
+  explicit List(const allocator_type& alloc);  // Empty list using alloc
+  // Parameterized constructor
+  List(size_type n, const allocator_type& alloc = allocator_type());
+  // Initializer list constructor
+  List(std::initializer_list<value_type> const& items,
+       const allocator_type& alloc = allocator_type());
   ~List();              // Destructor
   List(const List& l);  // copy constructor
   List(List&& l);       // move constructor
   List& operator=(List&& l);
+  allocator_type get_allocator() const;
+  using stats::Tracker<List>::alloc_stats;
 
   /// List Element access
   const_reference front();
@@ -44,12 +55,24 @@ class List {
     Node* prev_;
     Node* next_;
 
-    Node(value_type value) : value_(value), prev_(nullptr), next_(nullptr) {}
+    template <typename U>
+    explicit Node(U&& value)
+        : value_(std::forward<U>(value)), prev_(nullptr), next_(nullptr) {}
   };
 
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
   Node* head_;
   Node* tail_;
   size_type size_;
+  node_allocator allocator_;
+
+  // Copies or moves `value` into a node from allocator_.
+  template <typename U>
+  Node* create_node(U&& value);
+  void destroy_node(Node* node);
 
  public:
   template <typename value_type>
@@ -144,5 +167,13 @@ template class List<int>;
 template class List<double>;
 template class List<char>;
 template class List<float>;
+
+namespace pmr {
+template <typename T>
+using List = s21::List<T, PolymorphicAllocator<T>>;
+}  // namespace pmr
 }  // namespace s21
+
+#include "list.tpp"
+
 #endif
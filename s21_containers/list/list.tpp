@@ -1,42 +1,50 @@
-﻿#include "list.h"
+#ifndef LIST_TPP
+#define LIST_TPP
 
 #include <limits>
+#include <stdexcept>
+#include <utility>
 
-template <typename T>
-s21::List<T>::List() {
-  head_ = nullptr;
-  tail_ = nullptr;
-  size_ = 0;
-}
+#include "list.h"
+
+template <typename T, typename Allocator>
+s21::List<T, Allocator>::List() : List(Allocator()) {}
 
-template <typename T>
-s21::List<T>::List(size_type n) : head_(nullptr), tail_(nullptr) {
+template <typename T, typename Allocator>
+s21::List<T, Allocator>::List(const allocator_type& alloc)
+    : head_(nullptr), tail_(nullptr), size_(0), allocator_(alloc) {}
+
+template <typename T, typename Allocator>
+s21::List<T, Allocator>::List(size_type n, const allocator_type& alloc)
+    : List(alloc) {
   initialize(n);
 }
 
-template <typename T>
-s21::List<T>::List(std::initializer_list<value_type> const& items)
-    : head_(nullptr), tail_(nullptr) {
+template <typename T, typename Allocator>
+s21::List<T, Allocator>::List(std::initializer_list<value_type> const& items,
+                              const allocator_type& alloc)
+    : List(alloc) {
   size_ = items.size();
   for (const auto& item : items) {
     if (head_ == nullptr) {
-      head_ = new Node(item);
+      head_ = create_node(item);
       tail_ = head_;
     } else {
-      tail_->next_ = new Node(item);
+      tail_->next_ = create_node(item);
       tail_->next_->prev_ = tail_;
       tail_ = tail_->next_;
     }
   }
 }
 
-template <typename T>
-s21::List<T>::~List() {
+template <typename T, typename Allocator>
+s21::List<T, Allocator>::~List() {
   clear();
 }
 
-template <typename T>
-s21::List<T>::List(const List& l) : head_(nullptr), tail_(nullptr) {
+template <typename T, typename Allocator>
+s21::List<T, Allocator>::List(const List& l)
+    : List(node_traits::select_on_container_copy_construction(l.allocator_)) {
   Node* cur = l.head_;
   while (cur != nullptr) {
     push_back(cur->value_);
@@ -44,23 +52,26 @@ s21::List<T>::List(const List& l) : head_(nullptr), tail_(nullptr) {
   }
 }
 
-template <typename T>
-s21::List<T>::List(List&& l) {
+template <typename T, typename Allocator>
+s21::List<T, Allocator>::List(List&& l) : allocator_(std::move(l.allocator_)) {
   head_ = l.head_;
   tail_ = l.tail_;
   size_ = l.size_;
   l.size_ = 0;
   l.head_ = nullptr;
   l.tail_ = nullptr;
+  this->TrackAdopt(l);
 }
 
-template <typename T>
-typename s21::List<T>::List& s21::List<T>::operator=(List&& l) {
-  if (this != &l) {
-    while (head_ != nullptr) {
-      Node* tmp = head_;
-      head_ = head_->next_;
-      delete tmp;
+template <typename T, typename Allocator>
+typename s21::List<T, Allocator>::List& s21::List<T, Allocator>::operator=(
+    List&& l) {
+  if (this == &l) return *this;
+  clear();
+  if (node_traits::propagate_on_container_move_assignment::value ||
+      allocator_ == l.allocator_) {
+    if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+      allocator_ = std::move(l.allocator_);
     }
     head_ = l.head_;
     tail_ = l.tail_;
@@ -68,31 +79,51 @@ typename s21::List<T>::List& s21::List<T>::operator=(List&& l) {
     l.head_ = nullptr;
     l.tail_ = nullptr;
     l.size_ = 0;
+    this->TrackAdopt(l);
+  } else {
+    // Nodes owned by an unequal allocator that stays behind are moved
+    // element by element into nodes of our own.
+    for (Node* cur = l.head_; cur != nullptr; cur = cur->next_) {
+      Node* node = create_node(std::move(cur->value_));
+      node->prev_ = tail_;
+      (tail_ ? tail_->next_ : head_) = node;
+      tail_ = node;
+      ++size_;
+    }
+    l.clear();
   }
   return *this;
 }
 
-template <typename T>
-typename s21::List<T>::const_reference s21::List<T>::front() {
+template <typename T, typename Allocator>
+typename s21::List<T, Allocator>::allocator_type
+s21::List<T, Allocator>::get_allocator() const {
+  return allocator_type(allocator_);
+}
+
+template <typename T, typename Allocator>
+typename s21::List<T, Allocator>::const_reference
+s21::List<T, Allocator>::front() {
   if (head_ == nullptr) {
     throw std::out_of_range("List is empty");
   }
   return head_->value_;
 }
 
-template <typename T>
-typename s21::List<T>::const_reference s21::List<T>::back() {
+template <typename T, typename Allocator>
+typename s21::List<T, Allocator>::const_reference
+s21::List<T, Allocator>::back() {
   if (tail_ == nullptr) {
     throw std::out_of_range("List is empty");
   }
   return tail_->value_;
 }
 
-template <typename T>
-void s21::List<T>::initialize(size_type n) {
+template <typename T, typename Allocator>
+void s21::List<T, Allocator>::initialize(size_type n) {
   size_ = n;
   for (size_type i = 0; i < n; ++i) {
-    Node* newNode = new Node(0);
+    Node* newNode = create_node(value_type());
     if (head_ == nullptr) {
       head_ = tail_ = newNode;
     } else {
@@ -103,8 +134,8 @@ void s21::List<T>::initialize(size_type n) {
   }
 }
 
-template <typename T>
-void s21::List<T>::printList() {
+template <typename T, typename Allocator>
+void s21::List<T, Allocator>::printList() {
   Node* i = head_;
   while (i != nullptr) {
     std::cout << i->value_ << " ";
@@ -113,8 +144,8 @@ void s21::List<T>::printList() {
   std::cout << std::endl;
 }
 
-template <typename T>
-void s21::List<T>::fillList() {
+template <typename T, typename Allocator>
+void s21::List<T, Allocator>::fillList() {
   Node* cur = head_;
   for (value_type i = 0; cur != nullptr; ++i) {
     cur->value_ = i;
@@ -122,54 +153,56 @@ void s21::List<T>::fillList() {
   }
 }
 
-template <typename T>
-typename s21::List<T>::iterator s21::List<T>::begin() {
+template <typename T, typename Allocator>
+typename s21::List<T, Allocator>::iterator s21::List<T, Allocator>::begin() {
   return iterator(head_);
 }
 
-template <typename T>
-typename s21::List<T>::iterator s21::List<T>::end() {
+template <typename T, typename Allocator>
+typename s21::List<T, Allocator>::iterator s21::List<T, Allocator>::end() {
   return iterator(nullptr);
 }
 
-template <typename T>
-typename s21::List<T>::const_iterator s21::List<T>::begin() const {
+template <typename T, typename Allocator>
+typename s21::List<T, Allocator>::const_iterator
+s21::List<T, Allocator>::begin() const {
   return const_iterator(head_);
 }
 
-template <typename T>
-typename s21::List<T>::const_iterator s21::List<T>::end() const {
+template <typename T, typename Allocator>
+typename s21::List<T, Allocator>::const_iterator
+s21::List<T, Allocator>::end() const {
   return const_iterator(nullptr);
 }
 
-template <typename T>
-typename s21::List<T>::size_type s21::List<T>::size() {
+template <typename T, typename Allocator>
+typename s21::List<T, Allocator>::size_type s21::List<T, Allocator>::size() {
   int c = 0;
   Node* cur = head_;
   while (cur != nullptr) {
     cur = cur->next_;
     c++;
   }
-  delete cur;
   return c;
 }
 
-template <typename T>
-bool s21::List<T>::empty() {
+template <typename T, typename Allocator>
+bool s21::List<T, Allocator>::empty() {
   return size_ == 0;
 }
 
-template <typename T>
-typename s21::List<T>::size_type s21::List<T>::max_size() {
-  return (std::numeric_limits<size_type>::max() / sizeof(Node) / 2);
+template <typename T, typename Allocator>
+typename s21::List<T, Allocator>::size_type
+s21::List<T, Allocator>::max_size() {
+  return node_traits::max_size(allocator_);
 }
 
-template <typename T>
-void s21::List<T>::clear() {
+template <typename T, typename Allocator>
+void s21::List<T, Allocator>::clear() {
   Node* current = head_;
   while (current != nullptr) {
     Node* next = current->next_;
-    delete current;
+    destroy_node(current);
     current = next;
   }
   head_ = nullptr;
@@ -177,10 +210,10 @@ void s21::List<T>::clear() {
   size_ = 0;
 }
 
-template <typename T>
-typename s21::List<T>::iterator s21::List<T>::insert(iterator pos,
-                                                     const_reference value) {
-  Node* newNode = new Node(value);
+template <typename T, typename Allocator>
+typename s21::List<T, Allocator>::iterator s21::List<T, Allocator>::insert(
+    iterator pos, const_reference value) {
+  Node* newNode = create_node(value);
   Node* current = pos.get_node();
 
   if (current == nullptr) {
@@ -205,8 +238,8 @@ typename s21::List<T>::iterator s21::List<T>::insert(iterator pos,
   return iterator(newNode);
 }
 
-template <typename T>
-void s21::List<T>::erase(iterator pos) {
+template <typename T, typename Allocator>
+void s21::List<T, Allocator>::erase(iterator pos) {
   Node* current = pos.get_node();
   if (current == nullptr) {
     throw std::out_of_range("Iterator does not point to a valid node");
@@ -231,25 +264,25 @@ void s21::List<T>::erase(iterator pos) {
     current->next_->prev_ = current->prev_;
   }
 
-  delete current;
+  destroy_node(current);
   --size_;
 }
 
-template <typename T>
-void s21::List<T>::push_back(const_reference value) {
+template <typename T, typename Allocator>
+void s21::List<T, Allocator>::push_back(const_reference value) {
   size_++;
   if (head_ == nullptr) {
-    head_ = new Node(value);
+    head_ = create_node(value);
     tail_ = head_;
   } else {
-    tail_->next_ = new Node(value);
+    tail_->next_ = create_node(value);
     tail_->next_->prev_ = tail_;
     tail_ = tail_->next_;
   }
 }
 
-template <typename T>
-void s21::List<T>::pop_back() {
+template <typename T, typename Allocator>
+void s21::List<T, Allocator>::pop_back() {
   if (tail_ == nullptr) {
     throw std::out_of_range("List is empty");
   }
@@ -260,13 +293,13 @@ void s21::List<T>::pop_back() {
   } else {
     head_ = tail_ = nullptr;
   }
-  delete tmp;
+  destroy_node(tmp);
   --size_;
 }
 
-template <typename T>
-void s21::List<T>::push_front(const_reference value) {
-  Node* newNode = new Node(value);
+template <typename T, typename Allocator>
+void s21::List<T, Allocator>::push_front(const_reference value) {
+  Node* newNode = create_node(value);
   newNode->next_ = head_;
   if (head_ != nullptr) {
     head_->prev_ = newNode;
@@ -277,8 +310,8 @@ void s21::List<T>::push_front(const_reference value) {
   size_++;
 }
 
-template <typename T>
-void s21::List<T>::pop_front() {
+template <typename T, typename Allocator>
+void s21::List<T, Allocator>::pop_front() {
   if (head_ == nullptr) {
     throw std::out_of_range("List is empty");
   }
@@ -289,19 +322,23 @@ void s21::List<T>::pop_front() {
   } else {
     head_ = tail_ = nullptr;
   }
-  delete tmp;
+  destroy_node(tmp);
   --size_;
 }
 
-template <typename T>
-void s21::List<T>::swap(List& other) {
+template <typename T, typename Allocator>
+void s21::List<T, Allocator>::swap(List& other) {
+  if constexpr (node_traits::propagate_on_container_swap::value) {
+    std::swap(allocator_, other.allocator_);
+  }
   std::swap(head_, other.head_);
   std::swap(tail_, other.tail_);
   std::swap(size_, other.size_);
+  this->TrackSwap(other);
 }
 
-template <typename T>
-void s21::List<T>::merge(List& other) {
+template <typename T, typename Allocator>
+void s21::List<T, Allocator>::merge(List& other) {
   if (this == &other) {
     throw std::invalid_argument("Cannot merge the list with itself");
   }
@@ -318,7 +355,7 @@ void s21::List<T>::merge(List& other) {
 
     while (cur != nullptr && cur->value_ <= other_cur->value_) {
       if (cur->next_ == nullptr || cur->next_->value_ > other_cur->value_) {
-        Node* newNode = new Node(other_cur->value_);
+        Node* newNode = create_node(other_cur->value_);
         newNode->next_ = cur->next_;
         newNode->prev_ = cur;
         if (cur->next_ != nullptr) {
@@ -339,13 +376,11 @@ void s21::List<T>::merge(List& other) {
   }
 
   // Очистка другого списка
-  other.head_ = nullptr;
-  other.tail_ = nullptr;
-  other.size_ = 0;
+  other.clear();
 }
 
-template <typename T>
-void s21::List<T>::splice(const_iterator pos, List& other) {
+template <typename T, typename Allocator>
+void s21::List<T, Allocator>::splice(const_iterator pos, List& other) {
   if (this == &other) {
     throw std::invalid_argument("Cannot splice the list with itself");
   }
@@ -357,8 +392,8 @@ void s21::List<T>::splice(const_iterator pos, List& other) {
   }
 }
 
-template <typename T>
-void s21::List<T>::reverse() {
+template <typename T, typename Allocator>
+void s21::List<T, Allocator>::reverse() {
   Node* current = head_;
   Node* temp = nullptr;
 
@@ -377,8 +412,8 @@ void s21::List<T>::reverse() {
   }
 }
 
-template <typename T>
-void s21::List<T>::unique() {
+template <typename T, typename Allocator>
+void s21::List<T, Allocator>::unique() {
   if (head_ == nullptr) return;
   Node* current = head_->next_;
   while (current != nullptr) {
@@ -391,7 +426,7 @@ void s21::List<T>::unique() {
         tail_ = current->prev_;
       }
       current = current->next_;
-      delete duplicate;
+      destroy_node(duplicate);
       --size_;
     } else {
       current = current->next_;
@@ -399,15 +434,15 @@ void s21::List<T>::unique() {
   }
 }
 
-template <typename T>
-void s21::List<T>::sort() {
+template <typename T, typename Allocator>
+void s21::List<T, Allocator>::sort() {
   if (size_ > 1) {
     quickSort(head_, tail_);
   }
 }
 
-template <typename T>
-void s21::List<T>::quickSort(Node* low, Node* high) {
+template <typename T, typename Allocator>
+void s21::List<T, Allocator>::quickSort(Node* low, Node* high) {
   if (low != nullptr && high != nullptr && low != high && low != high->next_) {
     Node* pivot = partition(low, high);
     quickSort(low, pivot->prev_);
@@ -415,8 +450,9 @@ void s21::List<T>::quickSort(Node* low, Node* high) {
   }
 }
 
-template <typename T>
-typename s21::List<T>::Node* s21::List<T>::partition(Node* low, Node* high) {
+template <typename T, typename Allocator>
+typename s21::List<T, Allocator>::Node* s21::List<T, Allocator>::partition(
+    Node* low, Node* high) {
   T pivotValue = high->value_;
   Node* i = low->prev_;
 
@@ -430,3 +466,27 @@ typename s21::List<T>::Node* s21::List<T>::partition(Node* low, Node* high) {
   std::swap(i->value_, high->value_);
   return i;
 }
+
+template <typename T, typename Allocator>
+template <typename U>
+typename s21::List<T, Allocator>::Node* s21::List<T, Allocator>::create_node(
+    U&& value) {
+  Node* node = node_traits::allocate(allocator_, 1);
+  try {
+    node_traits::construct(allocator_, node, std::forward<U>(value));
+  } catch (...) {
+    node_traits::deallocate(allocator_, node, 1);
+    throw;
+  }
+  this->TrackAllocate(sizeof(Node));
+  return node;
+}
+
+template <typename T, typename Allocator>
+void s21::List<T, Allocator>::destroy_node(Node* node) {
+  node_traits::destroy(allocator_, node);
+  node_traits::deallocate(allocator_, node, 1);
+  this->TrackDeallocate(sizeof(Node));
+}
+
+#endif  // LIST_TPP
@@ -0,0 +1,96 @@
+#ifndef ALIGNED_ALLOCATOR_H
+#define ALIGNED_ALLOCATOR_H
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace s21 {
+constexpr std::size_t kCacheLineSize = 64;
+constexpr std::size_t kHugePageSize = std::size_t(2) << 20;
+
+/// Allocator returning storage aligned to `Alignment` bytes (at least
+/// alignof(T)). With HugePages set, blocks of kHugePageSize or more are
+/// aligned and rounded to whole 2MB pages and, on Linux, advised with
+/// MADV_HUGEPAGE so transparent huge pages can back them.
+template <class T, std::size_t Alignment = kCacheLineSize,
+          bool HugePages = false>
+class AlignedAllocator {
+  static_assert(Alignment && !(Alignment & (Alignment - 1)),
+                "Alignment must be a power of two");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal = std::true_type;
+
+  template <class U>
+  struct rebind {
+    using other = AlignedAllocator<U, Alignment, HugePages>;
+  };
+
+  static constexpr std::size_t alignment =
+      Alignment > alignof(T) ? Alignment : alignof(T);
+
+  AlignedAllocator() noexcept = default;
+  template <class U>
+  AlignedAllocator(const AlignedAllocator<U, Alignment, HugePages> &) noexcept {
+  }
+
+  T *allocate(size_type n) {
+    if (n > max_size()) throw std::bad_array_new_length();
+    size_type bytes = n * sizeof(T);
+    std::size_t align = BlockAlignment(bytes);
+    bytes = BlockSize(bytes);
+    void *p = ::operator new(bytes, std::align_val_t(align));
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (Huge(bytes)) madvise(p, bytes, MADV_HUGEPAGE);
+#endif
+    return static_cast<T *>(p);
+  }
+
+  void deallocate(T *p, size_type n) noexcept {
+    size_type bytes = n * sizeof(T);
+    ::operator delete(p, BlockSize(bytes),
+                      std::align_val_t(BlockAlignment(bytes)));
+  }
+
+  size_type max_size() const noexcept {
+    return std::numeric_limits<difference_type>::max() / sizeof(T);
+  }
+
+ private:
+  static bool Huge(size_type bytes) {
+    return HugePages && bytes >= kHugePageSize;
+  }
+  static std::size_t BlockAlignment(size_type bytes) {
+    return Huge(bytes) && alignment < kHugePageSize ? kHugePageSize
+                                                    : alignment;
+  }
+  static size_type BlockSize(size_type bytes) {
+    if (!Huge(bytes)) return bytes;
+    return (bytes + kHugePageSize - 1) / kHugePageSize * kHugePageSize;
+  }
+};
+
+template <class T, class U, std::size_t Alignment, bool HugePages>
+bool operator==(const AlignedAllocator<T, Alignment, HugePages> &,
+                const AlignedAllocator<U, Alignment, HugePages> &) noexcept {
+  return true;
+}
+
+template <class T, class U, std::size_t Alignment, bool HugePages>
+bool operator!=(const AlignedAllocator<T, Alignment, HugePages> &,
+                const AlignedAllocator<U, Alignment, HugePages> &) noexcept {
+  return false;
+}
+}  // namespace s21
+
+#endif  // ALIGNED_ALLOCATOR_H
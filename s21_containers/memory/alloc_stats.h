@@ -0,0 +1,232 @@
+#ifndef S21_ALLOC_STATS_H
+#define S21_ALLOC_STATS_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// Opt-in allocation counting for the containers. Build with
+// -DS21_ALLOC_STATS (make ALLOC_STATS=1, cmake -DS21_ALLOC_STATS=ON) to
+// record every allocate/deallocate a container makes through its allocator,
+// per instance, per container type and for the whole program. Without the
+// flag the hooks are empty and the tracker is an empty base, so containers
+// keep their size and code. Every translation unit of a program must be
+// built with the same setting.
+namespace s21 {
+namespace stats {
+#ifdef S21_ALLOC_STATS
+inline constexpr bool kEnabled = true;
+#else
+inline constexpr bool kEnabled = false;
+#endif
+
+/// Counters of one instance, one container type or the whole program.
+struct Counters {
+  std::size_t allocations = 0;
+  std::size_t deallocations = 0;
+  std::size_t bytes_allocated = 0;
+  std::size_t bytes_deallocated = 0;
+  std::size_t live_bytes = 0;
+  std::size_t peak_bytes = 0;
+
+  // `bytes` in `count` allocations, for work tallied in bulk.
+  void OnAllocate(std::size_t bytes, std::size_t count = 1) {
+    allocations += count;
+    bytes_allocated += bytes;
+    live_bytes += bytes;
+    peak_bytes = std::max(peak_bytes, live_bytes);
+  }
+  void OnDeallocate(std::size_t bytes, std::size_t count = 1) {
+    deallocations += count;
+    bytes_deallocated += bytes;
+    live_bytes -= std::min(live_bytes, bytes);
+  }
+  // Takes over the history of storage that changed hands in a move.
+  void Adopt(Counters &other) {
+    allocations += other.allocations;
+    deallocations += other.deallocations;
+    bytes_allocated += other.bytes_allocated;
+    bytes_deallocated += other.bytes_deallocated;
+    live_bytes += other.live_bytes;
+    peak_bytes = std::max({peak_bytes, other.peak_bytes, live_bytes});
+    other = Counters();
+  }
+};
+
+namespace detail {
+// Type-wide and program-wide counters are shared between threads.
+class SharedCounters {
+ public:
+  void OnAllocate(std::size_t bytes, std::size_t count = 1) {
+    allocations_.fetch_add(count, std::memory_order_relaxed);
+    bytes_allocated_.fetch_add(bytes, std::memory_order_relaxed);
+    std::size_t live =
+        live_bytes_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    std::size_t peak = peak_bytes_.load(std::memory_order_relaxed);
+    while (peak < live && !peak_bytes_.compare_exchange_weak(
+                              peak, live, std::memory_order_relaxed)) {
+    }
+  }
+  void OnDeallocate(std::size_t bytes, std::size_t count = 1) {
+    deallocations_.fetch_add(count, std::memory_order_relaxed);
+    bytes_deallocated_.fetch_add(bytes, std::memory_order_relaxed);
+    live_bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+  }
+  Counters Get() const {
+    Counters c;
+    c.allocations = allocations_.load(std::memory_order_relaxed);
+    c.deallocations = deallocations_.load(std::memory_order_relaxed);
+    c.bytes_allocated = bytes_allocated_.load(std::memory_order_relaxed);
+    c.bytes_deallocated = bytes_deallocated_.load(std::memory_order_relaxed);
+    c.live_bytes = live_bytes_.load(std::memory_order_relaxed);
+    c.peak_bytes = peak_bytes_.load(std::memory_order_relaxed);
+    return c;
+  }
+  // Live bytes describe storage that still exists and are kept; the peak
+  // restarts from them.
+  void Reset() {
+    allocations_.store(0, std::memory_order_relaxed);
+    deallocations_.store(0, std::memory_order_relaxed);
+    bytes_allocated_.store(0, std::memory_order_relaxed);
+    bytes_deallocated_.store(0, std::memory_order_relaxed);
+    peak_bytes_.store(live_bytes_.load(std::memory_order_relaxed),
+                      std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<std::size_t> allocations_{0};
+  std::atomic<std::size_t> deallocations_{0};
+  std::atomic<std::size_t> bytes_allocated_{0};
+  std::atomic<std::size_t> bytes_deallocated_{0};
+  std::atomic<std::size_t> live_bytes_{0};
+  std::atomic<std::size_t> peak_bytes_{0};
+};
+
+// Containers that keep their storage in a member report under that
+// member's type: Set/Map under their tree, Stack/Queue under their
+// container.
+template <class C, class = void>
+struct KeyOf {
+  using type = C;
+};
+template <class C>
+struct KeyOf<C, std::void_t<typename C::stats_key>> {
+  using type = typename C::stats_key;
+};
+
+template <class Key>
+SharedCounters &TypeCounters() {
+  static SharedCounters counters;
+  return counters;
+}
+
+inline SharedCounters &TotalCounters() {
+  static SharedCounters counters;
+  return counters;
+}
+}  // namespace detail
+
+/// Counters of every instance of Container, e.g. of<s21::Vector<int>>().
+template <class Container>
+Counters of() {
+  return detail::TypeCounters<typename detail::KeyOf<Container>::type>()
+      .Get();
+}
+
+/// Counters of one instance.
+template <class Container>
+Counters of(const Container &c) {
+  return c.alloc_stats();
+}
+
+/// Counters of every instrumented container in the program.
+inline Counters total() { return detail::TotalCounters().Get(); }
+
+template <class Container>
+void reset() {
+  detail::TypeCounters<typename detail::KeyOf<Container>::type>().Reset();
+}
+
+inline void reset_total() { detail::TotalCounters().Reset(); }
+
+/// Private base of the instrumented containers; Owner names the type the
+/// counters are filed under. Copies start from zero, moves and swaps carry
+/// the counters along with the storage via TrackAdopt/TrackSwap.
+template <class Owner>
+class Tracker {
+ public:
+  Counters alloc_stats() const {
+#ifdef S21_ALLOC_STATS
+    return counters_;
+#else
+    return Counters();
+#endif
+  }
+
+ protected:
+  Tracker() = default;
+  Tracker(const Tracker &) noexcept {}
+  Tracker &operator=(const Tracker &) noexcept { return *this; }
+  ~Tracker() = default;
+
+  // `count` allocations of `bytes` in total; containers that allocate
+  // from several threads tally there and report once.
+  void TrackAllocate([[maybe_unused]] std::size_t bytes,
+                     [[maybe_unused]] std::size_t count = 1) {
+#ifdef S21_ALLOC_STATS
+    counters_.OnAllocate(bytes, count);
+    detail::TypeCounters<Owner>().OnAllocate(bytes, count);
+    detail::TotalCounters().OnAllocate(bytes, count);
+#endif
+  }
+  void TrackDeallocate([[maybe_unused]] std::size_t bytes,
+                       [[maybe_unused]] std::size_t count = 1) {
+#ifdef S21_ALLOC_STATS
+    counters_.OnDeallocate(bytes, count);
+    detail::TypeCounters<Owner>().OnDeallocate(bytes, count);
+    detail::TotalCounters().OnDeallocate(bytes, count);
+#endif
+  }
+  // A node handed to another container through a node handle: only this
+  // instance's live bytes change, the storage itself stays live.
+  void TrackRelease([[maybe_unused]] std::size_t bytes) {
+#ifdef S21_ALLOC_STATS
+    counters_.live_bytes -= std::min(counters_.live_bytes, bytes);
+#endif
+  }
+  void TrackAcquire([[maybe_unused]] std::size_t bytes) {
+#ifdef S21_ALLOC_STATS
+    counters_.live_bytes += bytes;
+    counters_.peak_bytes = std::max(counters_.peak_bytes, counters_.live_bytes);
+#endif
+  }
+  // Storage freed after its container released it, with no instance left
+  // to file it under.
+  static void TrackOrphanDeallocate([[maybe_unused]] std::size_t bytes) {
+#ifdef S21_ALLOC_STATS
+    detail::TypeCounters<Owner>().OnDeallocate(bytes);
+    detail::TotalCounters().OnDeallocate(bytes);
+#endif
+  }
+  void TrackAdopt([[maybe_unused]] Tracker &other) {
+#ifdef S21_ALLOC_STATS
+    counters_.Adopt(other.counters_);
+#endif
+  }
+  void TrackSwap([[maybe_unused]] Tracker &other) {
+#ifdef S21_ALLOC_STATS
+    std::swap(counters_, other.counters_);
+#endif
+  }
+
+#ifdef S21_ALLOC_STATS
+ private:
+  Counters counters_;
+#endif
+};
+}  // namespace stats
+}  // namespace s21
+
+#endif  // S21_ALLOC_STATS_H
@@ -0,0 +1,276 @@
+#include "memory_resource.h"
+
+#include <atomic>
+#include <memory>
+
+namespace s21 {
+namespace pmr {
+namespace {
+class NewDeleteResource : public MemoryResource {
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+    if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+      return ::operator new(bytes, std::align_val_t(alignment));
+    }
+    return ::operator new(bytes);
+  }
+  void do_deallocate(void *p, std::size_t bytes,
+                     std::size_t alignment) override {
+    if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+      ::operator delete(p, bytes, std::align_val_t(alignment));
+    } else {
+      ::operator delete(p, bytes);
+    }
+  }
+  bool do_is_equal(const MemoryResource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+class NullResource : public MemoryResource {
+  void *do_allocate(std::size_t, std::size_t) override {
+    throw std::bad_alloc();
+  }
+  void do_deallocate(void *, std::size_t, std::size_t) override {}
+  bool do_is_equal(const MemoryResource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+std::atomic<MemoryResource *> &DefaultResource() {
+  static std::atomic<MemoryResource *> resource{new_delete_resource()};
+  return resource;
+}
+
+std::size_t AlignUp(std::size_t n, std::size_t alignment) {
+  return (n + alignment - 1) & ~(alignment - 1);
+}
+
+constexpr std::size_t kDefaultInitialSize = 1024;
+constexpr std::size_t kDefaultLargestBlock = 4096;
+constexpr std::size_t kDefaultBlocksPerChunk = 1024;
+constexpr std::size_t kMaxBlocksPerChunk = std::size_t(1) << 16;
+constexpr std::size_t kFirstBlocksPerChunk = 16;
+}  // namespace
+
+MemoryResource *new_delete_resource() noexcept {
+  static NewDeleteResource resource;
+  return &resource;
+}
+
+MemoryResource *null_memory_resource() noexcept {
+  static NullResource resource;
+  return &resource;
+}
+
+MemoryResource *get_default_resource() noexcept {
+  return DefaultResource().load(std::memory_order_acquire);
+}
+
+MemoryResource *set_default_resource(MemoryResource *resource) noexcept {
+  if (!resource) resource = new_delete_resource();
+  return DefaultResource().exchange(resource, std::memory_order_acq_rel);
+}
+
+// MonotonicBufferResource
+
+MonotonicBufferResource::MonotonicBufferResource(MemoryResource *upstream)
+    : MonotonicBufferResource(kDefaultInitialSize, upstream) {}
+
+MonotonicBufferResource::MonotonicBufferResource(std::size_t initial_size,
+                                                 MemoryResource *upstream)
+    : upstream_(upstream),
+      initial_buffer_(nullptr),
+      initial_size_(0),
+      next_size_(initial_size ? initial_size : 1),
+      current_(nullptr),
+      space_(0),
+      chunks_(nullptr) {}
+
+MonotonicBufferResource::MonotonicBufferResource(void *buffer,
+                                                 std::size_t size,
+                                                 MemoryResource *upstream)
+    : upstream_(upstream),
+      initial_buffer_(buffer),
+      initial_size_(size),
+      next_size_(size ? size * 2 : kDefaultInitialSize),
+      current_(static_cast<char *>(buffer)),
+      space_(size),
+      chunks_(nullptr) {}
+
+MonotonicBufferResource::~MonotonicBufferResource() { release(); }
+
+void MonotonicBufferResource::release() {
+  while (chunks_) {
+    Chunk *prev = chunks_->prev;
+    upstream_->deallocate(chunks_, chunks_->size, chunks_->alignment);
+    chunks_ = prev;
+  }
+  current_ = static_cast<char *>(initial_buffer_);
+  space_ = initial_size_;
+  if (initial_size_) next_size_ = initial_size_ * 2;
+}
+
+void *MonotonicBufferResource::do_allocate(std::size_t bytes,
+                                           std::size_t alignment) {
+  if (!bytes) bytes = 1;
+  void *p = current_;
+  if (!current_ || !std::align(alignment, bytes, p, space_)) {
+    NewChunk(bytes, alignment);
+    p = current_;
+    std::align(alignment, bytes, p, space_);
+  }
+  current_ = static_cast<char *>(p) + bytes;
+  space_ -= bytes;
+  return p;
+}
+
+void MonotonicBufferResource::NewChunk(std::size_t bytes,
+                                       std::size_t alignment) {
+  std::size_t header = AlignUp(sizeof(Chunk), alignof(std::max_align_t));
+  std::size_t chunk_alignment =
+      alignment > alignof(Chunk) ? alignment : alignof(Chunk);
+  std::size_t need = header + bytes + alignment;
+  std::size_t size = next_size_ > need ? next_size_ : need;
+  void *memory = upstream_->allocate(size, chunk_alignment);
+  chunks_ = new (memory) Chunk{chunks_, size, chunk_alignment};
+  current_ = static_cast<char *>(memory) + header;
+  space_ = size - header;
+  next_size_ = size * 2;
+}
+
+// UnsynchronizedPoolResource
+
+UnsynchronizedPoolResource::UnsynchronizedPoolResource(
+    MemoryResource *upstream)
+    : UnsynchronizedPoolResource(PoolOptions(), upstream) {}
+
+UnsynchronizedPoolResource::UnsynchronizedPoolResource(
+    const PoolOptions &options, MemoryResource *upstream)
+    : upstream_(upstream),
+      options_(options),
+      pools_(),
+      pool_count_(0),
+      oversized_(nullptr) {
+  if (!options_.max_blocks_per_chunk) {
+    options_.max_blocks_per_chunk = kDefaultBlocksPerChunk;
+  } else if (options_.max_blocks_per_chunk > kMaxBlocksPerChunk) {
+    options_.max_blocks_per_chunk = kMaxBlocksPerChunk;
+  }
+  if (!options_.largest_required_pool_block) {
+    options_.largest_required_pool_block = kDefaultLargestBlock;
+  } else if (options_.largest_required_pool_block > kMaxPoolBlock) {
+    options_.largest_required_pool_block = kMaxPoolBlock;
+  }
+  std::size_t block = kMinBlock;
+  for (; block < options_.largest_required_pool_block; block <<= 1) {
+    pools_[pool_count_++].block_size = block;
+  }
+  pools_[pool_count_++].block_size = block;
+  options_.largest_required_pool_block = block;
+  Reset();
+}
+
+UnsynchronizedPoolResource::~UnsynchronizedPoolResource() { release(); }
+
+void UnsynchronizedPoolResource::release() {
+  for (std::size_t i = 0; i < pool_count_; ++i) {
+    Pool &pool = pools_[i];
+    while (pool.chunks) {
+      Chunk *prev = pool.chunks->prev;
+      upstream_->deallocate(pool.chunks->begin, pool.chunks->size,
+                            pool.block_size);
+      pool.chunks = prev;
+    }
+  }
+  while (oversized_) {
+    Oversized *next = oversized_->next;
+    upstream_->deallocate(oversized_, oversized_->bytes, oversized_->alignment);
+    oversized_ = next;
+  }
+  Reset();
+}
+
+void UnsynchronizedPoolResource::Reset() {
+  std::size_t first = kFirstBlocksPerChunk < options_.max_blocks_per_chunk
+                          ? kFirstBlocksPerChunk
+                          : options_.max_blocks_per_chunk;
+  for (std::size_t i = 0; i < pool_count_; ++i) {
+    pools_[i] = Pool{pools_[i].block_size, first, nullptr,
+                     nullptr, nullptr, nullptr};
+  }
+}
+
+std::size_t UnsynchronizedPoolResource::PoolIndex(
+    std::size_t bytes, std::size_t alignment) const {
+  std::size_t need = bytes > alignment ? bytes : alignment;
+  std::size_t index = 0;
+  while (index < pool_count_ && pools_[index].block_size < need) ++index;
+  return index;
+}
+
+void UnsynchronizedPoolResource::Refill(Pool &pool) {
+  // The chunk header lives after the blocks so blocks keep the chunk's
+  // block-size alignment.
+  std::size_t blocks_bytes = pool.block_size * pool.next_blocks;
+  std::size_t size = blocks_bytes + sizeof(Chunk);
+  char *memory =
+      static_cast<char *>(upstream_->allocate(size, pool.block_size));
+  pool.chunks = new (memory + blocks_bytes) Chunk{pool.chunks, memory, size};
+  pool.cursor = memory;
+  pool.end = memory + blocks_bytes;
+  if (pool.next_blocks < options_.max_blocks_per_chunk) {
+    pool.next_blocks *= 2;
+    if (pool.next_blocks > options_.max_blocks_per_chunk) {
+      pool.next_blocks = options_.max_blocks_per_chunk;
+    }
+  }
+}
+
+void *UnsynchronizedPoolResource::do_allocate(std::size_t bytes,
+                                              std::size_t alignment) {
+  std::size_t index = PoolIndex(bytes, alignment);
+  if (index == pool_count_) {
+    std::size_t align =
+        alignment > alignof(Oversized) ? alignment : alignof(Oversized);
+    std::size_t offset = AlignUp(sizeof(Oversized), align);
+    void *memory = upstream_->allocate(offset + bytes, align);
+    Oversized *header = new (memory)
+        Oversized{nullptr, oversized_, offset + bytes, align};
+    if (oversized_) oversized_->prev = header;
+    oversized_ = header;
+    return static_cast<char *>(memory) + offset;
+  }
+  Pool &pool = pools_[index];
+  if (pool.free) {
+    Block *block = pool.free;
+    pool.free = block->next;
+    return block;
+  }
+  if (pool.cursor == pool.end) Refill(pool);
+  void *p = pool.cursor;
+  pool.cursor += pool.block_size;
+  return p;
+}
+
+void UnsynchronizedPoolResource::do_deallocate(void *p, std::size_t bytes,
+                                               std::size_t alignment) {
+  std::size_t index = PoolIndex(bytes, alignment);
+  if (index == pool_count_) {
+    std::size_t align =
+        alignment > alignof(Oversized) ? alignment : alignof(Oversized);
+    Oversized *header = reinterpret_cast<Oversized *>(
+        static_cast<char *>(p) - AlignUp(sizeof(Oversized), align));
+    if (header->prev) {
+      header->prev->next = header->next;
+    } else {
+      oversized_ = header->next;
+    }
+    if (header->next) header->next->prev = header->prev;
+    upstream_->deallocate(header, header->bytes, header->alignment);
+    return;
+  }
+  Pool &pool = pools_[index];
+  pool.free = new (p) Block{pool.free};
+}
+}  // namespace pmr
+}  // namespace s21
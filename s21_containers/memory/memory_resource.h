@@ -0,0 +1,225 @@
+#ifndef MEMORY_RESOURCE_H
+#define MEMORY_RESOURCE_H
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <utility>
+
+#include "../array/array.h"
+
+namespace s21 {
+namespace pmr {
+/// Type-erased source of raw memory, modelled on std::pmr::memory_resource.
+/// Containers reach it through PolymorphicAllocator, so one container type
+/// can draw from a heap, a stack buffer or a pool chosen at run time.
+class MemoryResource {
+ public:
+  static constexpr std::size_t kMaxAlign = alignof(std::max_align_t);
+
+  virtual ~MemoryResource() = default;
+
+  void *allocate(std::size_t bytes, std::size_t alignment = kMaxAlign) {
+    return do_allocate(bytes, alignment);
+  }
+  void deallocate(void *p, std::size_t bytes,
+                  std::size_t alignment = kMaxAlign) {
+    do_deallocate(p, bytes, alignment);
+  }
+  bool is_equal(const MemoryResource &other) const noexcept {
+    return do_is_equal(other);
+  }
+
+ private:
+  virtual void *do_allocate(std::size_t bytes, std::size_t alignment) = 0;
+  virtual void do_deallocate(void *p, std::size_t bytes,
+                             std::size_t alignment) = 0;
+  virtual bool do_is_equal(const MemoryResource &other) const noexcept = 0;
+};
+
+inline bool operator==(const MemoryResource &a,
+                       const MemoryResource &b) noexcept {
+  return &a == &b || a.is_equal(b);
+}
+inline bool operator!=(const MemoryResource &a,
+                       const MemoryResource &b) noexcept {
+  return !(a == b);
+}
+
+/// Global operator new / delete.
+MemoryResource *new_delete_resource() noexcept;
+/// Throws std::bad_alloc on every allocation; use as the upstream of a
+/// buffer resource to assert that the buffer is never outgrown.
+MemoryResource *null_memory_resource() noexcept;
+/// Resource used by default-constructed allocators, new_delete_resource()
+/// unless replaced. set_default_resource(nullptr) restores it and every call
+/// returns the previous one.
+MemoryResource *get_default_resource() noexcept;
+MemoryResource *set_default_resource(MemoryResource *resource) noexcept;
+
+/// Bump-pointer allocator over an optional initial buffer. deallocate is a
+/// no-op; memory comes back all at once from release() or the destructor.
+/// When the buffer runs out, chunks of geometrically growing size are taken
+/// from the upstream resource. Not thread-safe.
+class MonotonicBufferResource : public MemoryResource {
+ public:
+  explicit MonotonicBufferResource(
+      MemoryResource *upstream = get_default_resource());
+  MonotonicBufferResource(std::size_t initial_size,
+                          MemoryResource *upstream = get_default_resource());
+  MonotonicBufferResource(void *buffer, std::size_t size,
+                          MemoryResource *upstream = get_default_resource());
+  MonotonicBufferResource(const MonotonicBufferResource &) = delete;
+  MonotonicBufferResource &operator=(const MonotonicBufferResource &) =
+      delete;
+  ~MonotonicBufferResource() override;
+
+  /// Returns every upstream chunk and rewinds to the initial buffer.
+  void release();
+  MemoryResource *upstream_resource() const { return upstream_; }
+
+ private:
+  struct Chunk {
+    Chunk *prev;
+    std::size_t size;
+    std::size_t alignment;
+  };
+
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void *, std::size_t, std::size_t) override {}
+  bool do_is_equal(const MemoryResource &other) const noexcept override {
+    return this == &other;
+  }
+  void NewChunk(std::size_t bytes, std::size_t alignment);
+
+  MemoryResource *upstream_;
+  void *initial_buffer_;
+  std::size_t initial_size_;
+  std::size_t next_size_;
+  char *current_;
+  std::size_t space_;
+  Chunk *chunks_;
+};
+
+/// Tuning knobs of UnsynchronizedPoolResource; zero picks the default.
+struct PoolOptions {
+  std::size_t max_blocks_per_chunk = 0;
+  std::size_t largest_required_pool_block = 0;
+};
+
+/// Segregated free lists, one per power-of-two block size. Freed blocks are
+/// reused by the next allocation of the same size class; requests above the
+/// largest pool block go straight to upstream. release() and the destructor
+/// return everything to upstream. Not thread-safe.
+class UnsynchronizedPoolResource : public MemoryResource {
+ public:
+  explicit UnsynchronizedPoolResource(
+      MemoryResource *upstream = get_default_resource());
+  explicit UnsynchronizedPoolResource(
+      const PoolOptions &options,
+      MemoryResource *upstream = get_default_resource());
+  UnsynchronizedPoolResource(const UnsynchronizedPoolResource &) = delete;
+  UnsynchronizedPoolResource &operator=(const UnsynchronizedPoolResource &) =
+      delete;
+  ~UnsynchronizedPoolResource() override;
+
+  void release();
+  MemoryResource *upstream_resource() const { return upstream_; }
+  PoolOptions options() const { return options_; }
+
+  static constexpr std::size_t kMinBlock = 8;
+  static constexpr std::size_t kMaxPoolBlock = std::size_t(1) << 20;
+
+ private:
+  struct Block {
+    Block *next;
+  };
+  struct Chunk {
+    Chunk *prev;
+    char *begin;
+    std::size_t size;
+  };
+  struct Pool {
+    std::size_t block_size;
+    std::size_t next_blocks;
+    Block *free;
+    char *cursor;
+    char *end;
+    Chunk *chunks;
+  };
+  struct Oversized {
+    Oversized *prev;
+    Oversized *next;
+    std::size_t bytes;
+    std::size_t alignment;
+  };
+  static constexpr std::size_t kPoolCount = 18;
+  static_assert(kMinBlock << (kPoolCount - 1) == kMaxPoolBlock,
+                "one pool per power of two up to kMaxPoolBlock");
+
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void *p, std::size_t bytes,
+                     std::size_t alignment) override;
+  bool do_is_equal(const MemoryResource &other) const noexcept override {
+    return this == &other;
+  }
+  std::size_t PoolIndex(std::size_t bytes, std::size_t alignment) const;
+  void Refill(Pool &pool);
+  void Reset();
+
+  MemoryResource *upstream_;
+  PoolOptions options_;
+  Array<Pool, kPoolCount> pools_;  // block size kMinBlock << i
+  std::size_t pool_count_;
+  Oversized *oversized_;
+};
+
+/// Allocator that forwards to a MemoryResource. It never propagates on copy,
+/// move or swap, so containers keep the resource they were built with and
+/// copies fall back to the default resource, as with std::pmr.
+template <class T>
+class PolymorphicAllocator {
+ public:
+  using value_type = T;
+
+  PolymorphicAllocator() noexcept : resource_(get_default_resource()) {}
+  PolymorphicAllocator(MemoryResource *resource) noexcept
+      : resource_(resource) {}
+  template <class U>
+  PolymorphicAllocator(const PolymorphicAllocator<U> &other) noexcept
+      : resource_(other.resource()) {}
+  PolymorphicAllocator &operator=(const PolymorphicAllocator &) = delete;
+
+  T *allocate(std::size_t n) {
+    if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<T *>(resource_->allocate(n * sizeof(T), alignof(T)));
+  }
+  void deallocate(T *p, std::size_t n) {
+    resource_->deallocate(p, n * sizeof(T), alignof(T));
+  }
+
+  PolymorphicAllocator select_on_container_copy_construction() const {
+    return PolymorphicAllocator();
+  }
+  MemoryResource *resource() const noexcept { return resource_; }
+
+ private:
+  MemoryResource *resource_;
+};
+
+template <class T, class U>
+bool operator==(const PolymorphicAllocator<T> &a,
+                const PolymorphicAllocator<U> &b) noexcept {
+  return *a.resource() == *b.resource();
+}
+template <class T, class U>
+bool operator!=(const PolymorphicAllocator<T> &a,
+                const PolymorphicAllocator<U> &b) noexcept {
+  return !(a == b);
+}
+}  // namespace pmr
+}  // namespace s21
+
+#endif  // MEMORY_RESOURCE_H
@@ -0,0 +1,217 @@
+#ifndef INDEXED_PRIORITY_QUEUE_H
+#define INDEXED_PRIORITY_QUEUE_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "../vector/vector.h"
+
+namespace s21 {
+/// Indexed d-ary heap. Every pushed element gets a handle that stays valid
+/// until the element leaves the queue, so its priority can be changed or the
+/// element removed in O(log n). top() is the element for which Compare holds
+/// against all the others (a min-heap for std::less).
+template <typename T, typename Compare = std::less<T>, std::size_t Arity = 4>
+class IndexedPriorityQueue {
+  static_assert(Arity >= 2, "Heap arity must be at least 2");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using handle_type = std::size_t;
+  using value_compare = Compare;
+
+  static constexpr handle_type npos = std::numeric_limits<handle_type>::max();
+
+  IndexedPriorityQueue() : comp_() {}
+  explicit IndexedPriorityQueue(const Compare &comp) : comp_(comp) {}
+  IndexedPriorityQueue(std::initializer_list<value_type> const &items)
+      : comp_() {
+    for (const auto &item : items) push(item);
+  }
+  IndexedPriorityQueue(const IndexedPriorityQueue &q) = default;
+  IndexedPriorityQueue(IndexedPriorityQueue &&q) = default;
+  ~IndexedPriorityQueue() = default;
+  IndexedPriorityQueue &operator=(IndexedPriorityQueue &&q) = default;
+
+  /// Element access
+  const_reference top() const {
+    if (empty()) throw std::out_of_range("Priority queue is empty");
+    return values_[heap_[0]];
+  }
+  handle_type top_handle() const {
+    if (empty()) throw std::out_of_range("Priority queue is empty");
+    return heap_[0];
+  }
+  const_reference get(handle_type handle) const {
+    CheckHandle(handle);
+    return values_[handle];
+  }
+  bool contains(handle_type handle) const {
+    return handle < pos_.size() && pos_[handle] != npos;
+  }
+
+  /// Capacity
+  bool empty() const { return heap_.empty(); }
+  size_type size() const { return heap_.size(); }
+  void reserve(size_type size) {
+    heap_.reserve(size);
+    pos_.reserve(size);
+    values_.reserve(size);
+  }
+
+  /// Modifiers
+  handle_type push(const_reference value) {
+    handle_type handle;
+    if (free_.empty()) {
+      handle = values_.size();
+      values_.push_back(value);
+      pos_.push_back(heap_.size());
+    } else {
+      handle = free_.back();
+      free_.pop_back();
+      values_[handle] = value;
+      pos_[handle] = heap_.size();
+    }
+    heap_.push_back(handle);
+    SiftUp(heap_.size() - 1);
+    return handle;
+  }
+
+  void pop() {
+    if (empty()) throw std::out_of_range("Priority queue is empty");
+    RemoveAt(0);
+  }
+
+  /// Moves the element towards the top: value must not compare worse than
+  /// the current one.
+  void decrease_key(handle_type handle, const_reference value) {
+    CheckHandle(handle);
+    if (comp_(values_[handle], value)) {
+      throw std::invalid_argument("New key is worse than the current one");
+    }
+    values_[handle] = value;
+    SiftUp(pos_[handle]);
+  }
+
+  /// Moves the element away from the top: value must not compare better
+  /// than the current one.
+  void increase_key(handle_type handle, const_reference value) {
+    CheckHandle(handle);
+    if (comp_(value, values_[handle])) {
+      throw std::invalid_argument("New key is better than the current one");
+    }
+    values_[handle] = value;
+    SiftDown(pos_[handle]);
+  }
+
+  /// Changes the key in whichever direction it moves.
+  void update(handle_type handle, const_reference value) {
+    CheckHandle(handle);
+    bool up = comp_(value, values_[handle]);
+    values_[handle] = value;
+    if (up) {
+      SiftUp(pos_[handle]);
+    } else {
+      SiftDown(pos_[handle]);
+    }
+  }
+
+  void erase(handle_type handle) {
+    CheckHandle(handle);
+    RemoveAt(pos_[handle]);
+  }
+
+  void clear() {
+    heap_.clear();
+    pos_.clear();
+    values_.clear();
+    free_.clear();
+  }
+
+  void swap(IndexedPriorityQueue &other) noexcept {
+    heap_.swap(other.heap_);
+    pos_.swap(other.pos_);
+    values_.swap(other.values_);
+    free_.swap(other.free_);
+    std::swap(comp_, other.comp_);
+  }
+
+ private:
+  Vector<handle_type> heap_;   // heap slot -> handle
+  Vector<size_type> pos_;      // handle -> heap slot, npos when released
+  Vector<value_type> values_;  // handle -> key
+  Vector<handle_type> free_;   // released handles ready for reuse
+  Compare comp_;
+
+  void CheckHandle(handle_type handle) const {
+    if (!contains(handle)) throw std::out_of_range("Invalid handle");
+  }
+
+  bool Better(size_type a, size_type b) const {
+    return comp_(values_[heap_[a]], values_[heap_[b]]);
+  }
+
+  void Place(size_type slot, handle_type handle) {
+    heap_[slot] = handle;
+    pos_[handle] = slot;
+  }
+
+  void SiftUp(size_type slot) {
+    handle_type handle = heap_[slot];
+    while (slot > 0) {
+      size_type parent = (slot - 1) / Arity;
+      if (!comp_(values_[handle], values_[heap_[parent]])) break;
+      Place(slot, heap_[parent]);
+      slot = parent;
+    }
+    Place(slot, handle);
+  }
+
+  void SiftDown(size_type slot) {
+    handle_type handle = heap_[slot];
+    size_type count = heap_.size();
+    while (true) {
+      size_type first = slot * Arity + 1;
+      if (first >= count) break;
+      size_type last = first + Arity < count ? first + Arity : count;
+      size_type best = first;
+      for (size_type child = first + 1; child < last; ++child) {
+        if (Better(child, best)) best = child;
+      }
+      if (!comp_(values_[heap_[best]], values_[handle])) break;
+      Place(slot, heap_[best]);
+      slot = best;
+    }
+    Place(slot, handle);
+  }
+
+  void RemoveAt(size_type slot) {
+    handle_type handle = heap_[slot];
+    size_type last = heap_.size() - 1;
+    if (slot != last) {
+      Place(slot, heap_[last]);
+    }
+    heap_.pop_back();
+    pos_[handle] = npos;
+    free_.push_back(handle);
+    if (slot < heap_.size()) {
+      SiftDown(slot);
+      SiftUp(slot);
+    }
+  }
+};
+
+template class IndexedPriorityQueue<int>;
+template class IndexedPriorityQueue<double>;
+template class IndexedPriorityQueue<char>;
+template class IndexedPriorityQueue<float>;
+}  // namespace s21
+
+#endif  // INDEXED_PRIORITY_QUEUE_H
@@ -1,6 +1,8 @@
 #ifndef QUEUE_H
 #define QUEUE_H
 
+#include <type_traits>
+
 #include "../list/list.h"
 namespace s21 {
 template <typename T, typename Container = s21::List<T>>
@@ -10,6 +12,7 @@ class Queue {
   using reference = typename Container::reference;
   using const_reference = typename Container::const_reference;
   using size_type = typename Container::size_type;
+  using stats_key = typename stats::detail::KeyOf<Container>::type;
 
  protected:
   Container cont;
@@ -17,6 +20,10 @@ class Queue {
  public:
   Queue() : cont() {}
   Queue(std::initializer_list<value_type> const &items) : cont(items) {}
+  // Builds the underlying container with alloc, e.g. a pmr resource.
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator_v<Container, Alloc>>>
+  explicit Queue(const Alloc &alloc) : cont(alloc) {}
   Queue(const Queue &q) : cont(q.cont) {}
   Queue(Queue &&q) noexcept : cont(std::move(q.cont)) {}
   ~Queue(){};
@@ -30,6 +37,7 @@ class Queue {
 
   bool empty() { return cont.empty(); }
   size_type size() { return cont.size(); }
+  stats::Counters alloc_stats() const { return stats::of(cont); }
 
   void push(const_reference value) { this->cont.push_back(value); }
   void pop() { this->cont.pop_front(); }
@@ -40,6 +48,11 @@ template class Queue<int>;
 template class Queue<double>;
 template class Queue<char>;
 template class Queue<float>;
+
+namespace pmr {
+template <typename T>
+using Queue = s21::Queue<T, pmr::List<T>>;
+}  // namespace pmr
 }  // namespace s21
 
 #endif  // QUEUE_H
@@ -0,0 +1,71 @@
+#ifndef SRC_AGGREGATE_H_
+#define SRC_AGGREGATE_H_
+
+#include <limits>
+#include <utility>
+
+// Aggregates an AVLTree can keep in every node, folded over the node's
+// subtree and refreshed wherever the subtree size is: on insert, erase and
+// in both rotations. A policy provides
+//   using result_type = R;
+//   static R Identity();
+//   template <typename E> static R Lift(const E& element);
+//   static R Combine(const R& left, const R& right);
+// where Combine is associative and Identity its neutral element. Combine
+// always receives its arguments in key order, so it need not commute.
+namespace s21 {
+namespace aggregate {
+// No aggregate: nodes carry nothing beyond their size.
+struct None {};
+
+// What the shipped policies fold: the element itself in a Set, the mapped
+// value in a Map.
+template <typename E>
+const E& ValueOf(const E& element) {
+  return element;
+}
+template <typename K, typename V>
+const V& ValueOf(const std::pair<const K, V>& element) {
+  return element.second;
+}
+
+template <typename R>
+struct Sum {
+  using result_type = R;
+  static R Identity() { return R(); }
+  template <typename E>
+  static R Lift(const E& element) {
+    return R(ValueOf(element));
+  }
+  static R Combine(const R& left, const R& right) { return left + right; }
+};
+
+template <typename R>
+struct Min {
+  using result_type = R;
+  static R Identity() { return std::numeric_limits<R>::max(); }
+  template <typename E>
+  static R Lift(const E& element) {
+    return R(ValueOf(element));
+  }
+  static R Combine(const R& left, const R& right) {
+    return right < left ? right : left;
+  }
+};
+
+template <typename R>
+struct Max {
+  using result_type = R;
+  static R Identity() { return std::numeric_limits<R>::lowest(); }
+  template <typename E>
+  static R Lift(const E& element) {
+    return R(ValueOf(element));
+  }
+  static R Combine(const R& left, const R& right) {
+    return left < right ? right : left;
+  }
+};
+}  // namespace aggregate
+}  // namespace s21
+
+#endif  // SRC_AGGREGATE_H_
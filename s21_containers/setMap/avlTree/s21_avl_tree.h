@@ -1,7 +1,17 @@
 #ifndef SRC_AVL_H_
 #define SRC_AVL_H_
 
+#include <exception>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "../../memory/alloc_stats.h"
+#include "s21_aggregate.h"
+#include "s21_tree_parallel.h"
+#include "s21_tree_stats.h"
 using namespace std;
 
 namespace s21 {
@@ -34,29 +44,169 @@ class Node {
         left(nullptr),
         right(nullptr),
         parent(nullptr) {}
+
+  // Builds the key in place from `args`.
+  template <typename... Args>
+  explicit Node(std::in_place_t, Args&&... args)
+      : key(std::forward<Args>(args)...),
+        height(1),
+        size_(1),
+        isSentinel(false),
+        left(nullptr),
+        right(nullptr),
+        parent(nullptr) {}
+};
+// A pair ordered by its first member alone, for trees whose elements are
+// key-value pairs that may share a key or whose values do not compare.
+template <typename Pair>
+struct KeyOrdered : Pair {
+  using Pair::Pair;
+  bool operator==(const KeyOrdered& other) const {
+    return !(*this < other) && !(other < *this);
+  }
+  bool operator<(const KeyOrdered& other) const {
+    return this->first < other.first;
+  }
+  bool operator>(const KeyOrdered& other) const { return other < *this; }
+};
+
+// What the tree allocates: the node plus, unless Aggregate is
+// aggregate::None, the fold of Aggregate over the node's subtree.
+// Iterators only ever see the Node part.
+template <typename T, typename V, typename Aggregate>
+class AggregateNode : public Node<T, V> {
+ public:
+  using Node<T, V>::Node;
+  typename Aggregate::result_type aggregate;
 };
 template <typename T, typename V>
-class AVLTree {
+class AggregateNode<T, V, aggregate::None> : public Node<T, V> {
+ public:
+  using Node<T, V>::Node;
+};
+
+// Compare orders whole elements: Map hands it one that looks at keys only.
+// Tag only tells apart trees that are otherwise the same type, so that
+// containers built on one (Set and Multiset) keep separate stats counters.
+template <typename T, typename V, typename Allocator = std::allocator<T>,
+          typename Aggregate = aggregate::None,
+          typename Compare = std::less<T>, typename Tag = void>
+class AVLTree
+    : private stats::Tracker<
+          AVLTree<T, V, Allocator, Aggregate, Compare, Tag>>,
+      private TreeProbe {
  public:
+  using allocator_type = Allocator;
+  using compare_type = Compare;
+  using stored_node = AggregateNode<T, V, Aggregate>;
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<stored_node>;
+  static constexpr bool kAggregated =
+      !std::is_same_v<Aggregate, aggregate::None>;
+  // Move assignment only copies nodes when the allocators neither propagate
+  // nor compare equal.
+  static constexpr bool kNothrowMove =
+      std::allocator_traits<node_allocator>::
+          propagate_on_container_move_assignment::value ||
+      std::allocator_traits<node_allocator>::is_always_equal::value;
+  // Copy and Clear may spread over tree_parallel's pool.
+  static constexpr bool kParallel =
+      std::allocator_traits<node_allocator>::is_always_equal::value;
+
   AVLTree();
+  explicit AVLTree(const Allocator& alloc, const Compare& comp = Compare());
   AVLTree(const AVLTree& other);
+  AVLTree(AVLTree&& other) noexcept;
   ~AVLTree();
-  AVLTree<T, V>& operator=(AVLTree&& other) noexcept;
-  Node<T, V>* Insert(T key);
-  void Remove(T key);
-  Node<T, V>* Search(T key);
+  AVLTree& operator=(AVLTree&& other) noexcept(kNothrowMove);
+  // Inserts `key` unless an equal one is present and returns the node
+  // holding it either way; GetInserted() tells which.
+  Node<T, V>* Insert(const T& key);
+  // Builds a T from `args`, then links it unless an equal key is present,
+  // in which case the new node is freed again. Returns as Insert does.
+  template <typename... Args>
+  Node<T, V>* Emplace(Args&&... args);
+  // Builds a T from `args` only if no stored key is equivalent to `key`;
+  // `less` orders `key` against stored keys in both argument orders.
+  // Returns as Insert does.
+  template <typename K, typename Less, typename... Args>
+  Node<T, V>* EmplaceUnique(const K& key, Less less, Args&&... args);
+  // Inserts even when equal keys are present, after all of them; returns
+  // the new node.
+  Node<T, V>* InsertMulti(const T& key);
+  void Remove(const T& key);
+  // Removes exactly `node`, which must be in this tree.
+  void Erase(Node<T, V>* node);
+  // Erases every element for which `drop` holds in one pass that joins
+  // the surviving subtrees back together bottom-up: O(n), with no per-
+  // element descent. Returns how many were erased. Should `drop` throw,
+  // the elements not yet visited are kept.
+  template <typename Drop>
+  size_t EraseIf(Drop drop);
+  // Erases the nodes from `first` up to `last` in key order, `last`
+  // excluded and nullptr for the end: the range is split off by rank and
+  // freed, and the halves joined, in O(count + log n).
+  size_t EraseRange(Node<T, V>* first, Node<T, V>* last);
+  // Unlinks `node` like Erase but leaves it allocated: the caller owns it
+  // and hands it to InsertNode or DestroyDetached.
+  Node<T, V>* Extract(Node<T, V>* node);
+  // Links a node from Extract on a tree with an equal allocator unless an
+  // equal key is present. Returns as Insert does; when the key was there,
+  // `node` stays with the caller.
+  Node<T, V>* InsertNode(Node<T, V>* node);
+  // Links a node from Extract on a tree with an equal allocator after any
+  // equal keys already here; returns it.
+  Node<T, V>* InsertNodeMulti(Node<T, V>* node);
+  // Frees a node that Extract released and no tree took back.
+  static void DestroyDetached(const Allocator& alloc, Node<T, V>* node);
+  Node<T, V>* Search(const T& key);
+  // First node in key order for which `before` is false, or nullptr;
+  // `before` must hold for a prefix of the keys. One root-to-leaf walk,
+  // like std::partition_point: lower and upper bounds are both this.
+  template <typename Before>
+  Node<T, V>* PartitionPoint(Before before);
+  // Number of keys for which `before` holds, from subtree sizes.
+  template <typename Before>
+  size_t CountBefore(Before before);
+  // Aggregate over the keys for which `from` fails and `to` holds, with
+  // both predicates true on a prefix: at most two root-to-leaf walks.
+  template <typename Before, typename BeforeEnd>
+  auto Fold(Before from, BeforeEnd to);
+  // Recomputes the aggregates from `node` up to the root after the
+  // element it holds was changed in place.
+  void Refresh(Node<T, V>* node);
+  // The aggregate kept for the subtree under `node`, Identity() for none.
+  static auto AggregateOf(Node<T, V>* node);
   Node<T, V>* GetRoot() const;
   Node<T, V>* GetNil();
   void SetRoot(Node<T, V>* root);
-  void Swap(AVLTree<T, V>& other);
+  void Swap(AVLTree& other);
   void Clear(Node<T, V>* node);
   bool GetInserted();
   Node<T, V>* MaximumKey(Node<T, V>* node);
+  allocator_type GetAllocator() const;
+  Compare GetCompare() const;
+  size_t MaxSize() const;
+  using stats::Tracker<AVLTree>::alloc_stats;
+  // Shape of the tree plus its operation counters.
+  TreeStats Stats() const;
 
  private:
+  using node_traits = std::allocator_traits<node_allocator>;
+
   Node<T, V>* root;
   Node<T, V>* nil;
   bool inserted;
+  node_allocator alloc_;
+  Compare comp_;
+  template <typename... Args>
+  Node<T, V>* CreateNode(Args&&... args);
+  void DestroyNode(Node<T, V>* node);
+  // CreateNode and DestroyNode without the allocation counters, for work
+  // that may run on several threads and is counted once afterwards.
+  template <typename... Args>
+  static Node<T, V>* MakeNode(node_allocator& alloc, Args&&... args);
+  static void FreeNode(node_allocator& alloc, Node<T, V>* node);
   int Size(Node<T, V>* node);
   int Height(Node<T, V>* node);
   void UpdateSize(Node<T, V>* node);
@@ -64,13 +214,55 @@ class AVLTree {
   void UpdateHeight(Node<T, V>* node);
   Node<T, V>* Balance(Node<T, V>* node);
   Node<T, V>* FindMin(Node<T, V>* node);
-  Node<T, V>* CopyTree(Node<T, V>* node);
+  Node<T, V>* CopyTree(Node<T, V>* node, Node<T, V>* parent);
+  // A childless copy of `node` with its height, size and aggregate; with
+  // kMove the key is moved out of `node` instead of copied.
+  template <bool kMove = false>
+  static Node<T, V>* CopyNode(node_allocator& alloc, Node<T, V>* node);
+  // Copies the subtree under a non-null `node`, uncounted; if a copy
+  // throws, what was built is freed again.
+  template <bool kMove = false>
+  static Node<T, V>* CopySubtree(node_allocator& alloc, Node<T, V>* node);
+  // Frees the subtree under `node`, uncounted; returns the node count.
+  static size_t FreeSubtree(node_allocator& alloc, Node<T, V>* node);
+  // tree_parallel's pool if the subtree under `node` is big enough.
+  ThreadPool* PoolFor(Node<T, V>* node) const;
+  // CopySubtree and FreeSubtree with the subtrees a few levels down
+  // handed to `pool`, about four per thread.
+  Node<T, V>* CopyParallel(ThreadPool& pool, Node<T, V>* node);
+  size_t FreeParallel(ThreadPool& pool, Node<T, V>* node);
   Node<T, V>* RotateLeft(Node<T, V>* node);
   Node<T, V>* RotateRight(Node<T, V>* node);
   Node<T, V>* RemoveMin(Node<T, V>* node);
-  Node<T, V>* Remove(Node<T, V>* node, T key);
-  Node<T, V>* Search(Node<T, V>* node, T key);
-  Node<T, V>* Insert(Node<T, V>* node, T key, Node<T, V>* parent);
+  // Unlinks `node` and returns the balanced subtree that replaces it.
+  Node<T, V>* Detach(Node<T, V>* node);
+  // Unlinks `node` from wherever it sits, following its parent links.
+  void Unlink(Node<T, V>* node);
+  // EraseIf on the subtree under `node`; returns what is left of it.
+  template <typename Drop>
+  Node<T, V>* Filter(Node<T, V>* node, Drop& drop, size_t& erased,
+                     std::exception_ptr& error);
+  // One balanced tree from `left`, `mid` and `right`, whose keys are in
+  // that order, in O(1 + height difference).
+  Node<T, V>* Join(Node<T, V>* left, Node<T, V>* mid, Node<T, V>* right);
+  // Join without a middle node: `right` gives up its minimum.
+  Node<T, V>* Join(Node<T, V>* left, Node<T, V>* right);
+  // The first `count` nodes under `node` and the rest, in O(height).
+  std::pair<Node<T, V>*, Node<T, V>*> Split(Node<T, V>* node, size_t count);
+  // Number of nodes before `node` in key order.
+  size_t Rank(Node<T, V>* node);
+  // Node with a key equal to `key`, or nullptr.
+  Node<T, V>* Lookup(const T& key);
+  // Walks down to where `key` belongs and links make() there unless an
+  // equivalent key is present; sets `inserted` and returns the node that
+  // holds the key.
+  template <typename K, typename Less, typename Make>
+  Node<T, V>* InsertUnique(const K& key, Less& less, Make make);
+  // Walks down past any keys equal to `key` and links make() there.
+  template <typename Make>
+  Node<T, V>* LinkMulti(const T& key, Make make);
+  // Rebalances from `node` up to the root after a link below it.
+  void Retrace(Node<T, V>* node);
 };
 }  // namespace s21
 
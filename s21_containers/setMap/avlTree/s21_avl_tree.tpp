@@ -1,36 +1,93 @@
 #include "s21_avl_tree.h"
 namespace s21 {
-template <typename T, typename V>
-AVLTree<T, V>::AVLTree() : root(nullptr), nil(nullptr), inserted(false) {}
-template <typename T, typename V>
-AVLTree<T, V>::AVLTree(const AVLTree& other)
-    : root(CopyTree(other.GetRoot())) {}
-template <typename T, typename V>
-AVLTree<T, V>& AVLTree<T, V>::operator=(AVLTree&& other) noexcept {
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::AVLTree()
+    : AVLTree(Allocator()) {}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::AVLTree(
+    const Allocator& alloc, const Compare& comp)
+    : root(nullptr),
+      nil(nullptr),
+      inserted(false),
+      alloc_(alloc),
+      comp_(comp) {}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::AVLTree(const AVLTree& other)
+    : stats::Tracker<AVLTree>(),
+      TreeProbe(),
+      root(nullptr),
+      nil(nullptr),
+      inserted(false),
+      alloc_(node_traits::select_on_container_copy_construction(
+          other.alloc_)),
+      comp_(other.comp_) {
+  root = CopyTree(other.GetRoot(), nullptr);
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::AVLTree(
+    AVLTree&& other) noexcept
+    : root(exchange(other.root, nullptr)),
+      nil(nullptr),
+      inserted(false),
+      alloc_(std::move(other.alloc_)),
+      comp_(other.comp_) {
+  this->TrackAdopt(other);
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+AVLTree<T, V, Allocator, Aggregate, Compare, Tag>&
+AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::operator=(
+    AVLTree&& other) noexcept(kNothrowMove) {
   if (this != &other) {
     Clear(root);
+    comp_ = other.comp_;
+    if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+      alloc_ = std::move(other.alloc_);
+    } else if (!(alloc_ == other.alloc_)) {
+      // Nodes cannot change owner between unequal allocators: move the
+      // keys into nodes of ours and let the other tree release its own.
+      if (other.root) {
+        root = CopySubtree<true>(alloc_, other.root);
+        this->TrackAllocate(sizeof(stored_node) * root->size_, root->size_);
+      }
+      other.Clear(other.root);
+      return *this;
+    }
     root = exchange(other.root, nullptr);
+    this->TrackAdopt(other);
   }
   return *this;
 }
-template <typename T, typename V>
-int AVLTree<T, V>::Height(Node<T, V>* node) {
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+int AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Height(
+    Node<T, V>* node) {
   if (!node) return 0;
   return node->height;
 }
-template <typename T, typename V>
-int AVLTree<T, V>::BalanceFactor(Node<T, V>* node) {
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+int AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::BalanceFactor(
+    Node<T, V>* node) {
   if (!node) return 0;
   return (Height(node->left) - Height(node->right));
 }
-template <typename T, typename V>
-void AVLTree<T, V>::UpdateHeight(Node<T, V>* node) {
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+void AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::UpdateHeight(
+    Node<T, V>* node) {
   int hl = Height(node->left);
   int hr = Height(node->right);
   node->height = (hl > hr ? hl : hr) + 1;
 }
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::RotateRight(Node<T, V>* node) {
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::RotateRight(
+    Node<T, V>* node) {
   Node<T, V>* newRoot = node->left;
   node->left = newRoot->right;
   if (newRoot->right) {
@@ -39,12 +96,17 @@ Node<T, V>* AVLTree<T, V>::RotateRight(Node<T, V>* node) {
   newRoot->right = node;
   newRoot->parent = node->parent;
   node->parent = newRoot;
-  UpdateHeight(newRoot);
   UpdateHeight(node);
+  UpdateHeight(newRoot);
+  UpdateSize(node);
+  UpdateSize(newRoot);
+  this->OnRotateRight();
   return newRoot;
 }
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::RotateLeft(Node<T, V>* node) {
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::RotateLeft(
+    Node<T, V>* node) {
   Node<T, V>* newRoot = node->right;
   node->right = newRoot->left;
   if (newRoot->left) {
@@ -53,182 +115,855 @@ Node<T, V>* AVLTree<T, V>::RotateLeft(Node<T, V>* node) {
   newRoot->left = node;
   newRoot->parent = node->parent;
   node->parent = newRoot;
-  UpdateHeight(newRoot);
   UpdateHeight(node);
+  UpdateHeight(newRoot);
+  UpdateSize(node);
+  UpdateSize(newRoot);
+  this->OnRotateLeft();
   return newRoot;
 }
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::Balance(Node<T, V>* node) {
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+Node<T, V>*
+AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Balance(Node<T, V>* node) {
+  int old_height = node->height;
   UpdateHeight(node);
-  if (BalanceFactor(node) == 2) {
-    if (BalanceFactor(node->right) < -1) {
+  int balance = BalanceFactor(node);
+  if (balance > 1 || balance < -1 || node->height != old_height) {
+    this->OnRebalanceStep();
+  }
+  if (balance > 1) {
+    if (BalanceFactor(node->left) < 0) {
       node->left = RotateLeft(node->left);
-      UpdateSize(node->left);
     }
     node = RotateRight(node);
-    UpdateSize(node);
-  }
-  if (BalanceFactor(node) == -2) {
-    if (BalanceFactor(node->left) > 1) {
+  } else if (balance < -1) {
+    if (BalanceFactor(node->right) > 0) {
       node->right = RotateRight(node->right);
-      UpdateSize(node->right);
     }
     node = RotateLeft(node);
-    UpdateSize(node);
   }
   UpdateSize(node);
   return node;
 }
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::Insert(Node<T, V>* node, T key, Node<T, V>* parent) {
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+template <typename K, typename Less, typename Make>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::InsertUnique(
+    const K& key, Less& less, Make make) {
+  // One comparison per level: equal keys go right, so only the last node
+  // the walk went right at can be equal to `key`.
   this->inserted = false;
-  if (!node) {
-    node = new Node<T, V>(key);
-    node->parent = parent;
-    this->inserted = true;
-    return Balance(node);
-  }
-  if (key < node->key) {
-    node->left = Insert(node->left, key, node);
-  } else if (key > node->key) {
-    node->right = Insert(node->right, key, node);
+  Node<T, V>* parent = nullptr;
+  Node<T, V>* last = nullptr;
+  bool left = false;
+  for (Node<T, V>* node = root; node;) {
+    parent = node;
+    left = less(key, node->key);
+    if (left) {
+      node = node->left;
+    } else {
+      last = node;
+      node = node->right;
+    }
+  }
+  if (last && !less(last->key, key)) return last;
+  Node<T, V>* node = make();
+  node->parent = parent;
+  if (!parent) {
+    root = node;
+  } else if (left) {
+    parent->left = node;
   } else {
-    this->inserted = false;
+    parent->right = node;
+  }
+  this->inserted = true;
+  Retrace(node);
+  return node;
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+void AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Retrace(
+    Node<T, V>* node) {
+  while (true) {
+    Node<T, V>* parent = node->parent;
+    const bool left = parent && parent->left == node;
+    node = Balance(node);
+    if (!parent) {
+      root = node;
+      return;
+    }
+    (left ? parent->left : parent->right) = node;
+    node = parent;
   }
-  return Balance(node);
 }
 
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::FindMin(Node<T, V>* node) {
-  if (!node->left) return node;
-  return FindMin(node->left);
-}
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::RemoveMin(Node<T, V>* node) {
-  if (!node->left) return node->right;
-  node->left = RemoveMin(node->left);
-  return Balance(node);
-}
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::Remove(Node<T, V>* node, T key) {
-  if (!node) return nullptr;
-  if (key < node->key) {
-    node->left = Remove(node->left, key);
-  } else if (key > node->key) {
-    node->right = Remove(node->right, key);
-  } else {
-    Node<T, V>* left = node->left;
-    Node<T, V>* right = node->right;
-    delete node;
-    if (!right) return left;
-    if (!left) return right;
-    Node<T, V>* min = FindMin(right);
-    min->right = RemoveMin(right);
-    min->left = left;
-    min->size_--;
-    min->parent = node->parent;
-    UpdateHeight(min);
-    return Balance(min);
-  }
-  node->size_--;
-  UpdateHeight(node);
-  return Balance(node);
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+Node<T, V>*
+AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::FindMin(Node<T, V>* node) {
+  while (node->left) node = node->left;
+  return node;
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+Node<T, V>*
+AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::RemoveMin(Node<T, V>* node) {
+  // Splice out the leftmost node, then rebalance back up the left spine.
+  // `node` itself may hang off a stale parent, so the walk stops there
+  // rather than at a null parent.
+  Node<T, V>* min = FindMin(node);
+  if (min == node) return node->right;
+  Node<T, V>* up = min->parent;
+  up->left = min->right;
+  if (min->right) min->right->parent = up;
+  while (true) {
+    Node<T, V>* parent = up->parent;
+    const bool top = up == node;
+    up = Balance(up);
+    if (top) return up;
+    parent->left = up;
+    up = parent;
+  }
 }
-template <typename T, typename V>
-AVLTree<T, V>::~AVLTree() {
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+Node<T, V>*
+AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Detach(Node<T, V>* node) {
+  Node<T, V>* left = node->left;
+  Node<T, V>* right = node->right;
+  Node<T, V>* parent = node->parent;
+  if (!right) {
+    if (left) left->parent = parent;
+    return left;
+  }
+  Node<T, V>* min = FindMin(right);
+  min->right = RemoveMin(right);
+  if (min->right) min->right->parent = min;
+  min->left = left;
+  if (left) left->parent = min;
+  min->parent = parent;
+  return Balance(min);
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::~AVLTree() {
   Clear(root);
 }
-template <typename T, typename V>
-void AVLTree<T, V>::Clear(Node<T, V>* node) {
-  if (node != nullptr) {
-    Clear(node->left);
-    Clear(node->right);
-    delete node;
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+void AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Clear(
+    Node<T, V>* node) {
+  size_t freed = 0;
+  if (ThreadPool* pool = PoolFor(node)) {
+    freed = FreeParallel(*pool, node);
+  } else {
+    freed = FreeSubtree(alloc_, node);
   }
+  if (freed) this->TrackDeallocate(sizeof(stored_node) * freed, freed);
   root = nullptr;
 }
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::Search(Node<T, V>* node, T key) {
-  if (!node || node->key == key) {
-    return node;
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+size_t AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::FreeSubtree(
+    node_allocator& alloc, Node<T, V>* node) {
+  // Rotate left children up until the top has none, then free it and go
+  // on with its right subtree: O(1) space, no parent links needed, so it
+  // also serves subtrees split off the tree.
+  size_t freed = 0;
+  while (node) {
+    if (Node<T, V>* left = node->left) {
+      node->left = left->right;
+      left->right = node;
+      node = left;
+    } else {
+      Node<T, V>* right = node->right;
+      FreeNode(alloc, node);
+      ++freed;
+      node = right;
+    }
   }
-  if (key < node->key) {
-    return Search(node->left, key);
-  } else {
-    return Search(node->right, key);
+  return freed;
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+size_t AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::FreeParallel(
+    ThreadPool& pool, Node<T, V>* node) {
+  // Breadth-first from the top until the next level is wide enough; the
+  // nodes above it go last, on this thread.
+  const size_t tasks = 4 * pool.concurrency();
+  Vector<Node<T, V>*> upper;
+  Vector<Node<T, V>*> level;
+  level.push_back(node);
+  while (level.size() < tasks) {
+    Vector<Node<T, V>*> next;
+    for (size_t i = 0; i < level.size(); ++i) {
+      upper.push_back(level[i]);
+      if (level[i]->left) next.push_back(level[i]->left);
+      if (level[i]->right) next.push_back(level[i]->right);
+    }
+    level.swap(next);
+    if (level.empty()) break;
+  }
+  Vector<size_t> freed(level.size());
+  pool.parallel_for(level.size(), [this, &level, &freed](size_t i) {
+    node_allocator alloc(alloc_);
+    freed[i] = FreeSubtree(alloc, level[i]);
+  });
+  size_t total = upper.size();
+  for (size_t i = 0; i < freed.size(); ++i) total += freed[i];
+  for (size_t i = 0; i < upper.size(); ++i) FreeNode(alloc_, upper[i]);
+  return total;
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Lookup(
+    const T& key) {
+  // One comparison per level, as in Insert: descend to a leaf and test the
+  // last node not above `key` for equality once.
+  Node<T, V>* last = nullptr;
+  for (Node<T, V>* node = root; node;) {
+    this->OnSearchStep();
+    if (comp_(key, node->key)) {
+      node = node->left;
+    } else {
+      last = node;
+      node = node->right;
+    }
   }
+  return last && !comp_(last->key, key) ? last : nullptr;
 }
-template <typename T, typename V>
-void AVLTree<T, V>::SetRoot(Node<T, V>* root) {
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+void AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::SetRoot(
+    Node<T, V>* root) {
   this->root = root;
   if (this->root != nullptr) {
     this->root->parent = nullptr;
   }
 }
-template <typename T, typename V>
-void AVLTree<T, V>::UpdateSize(Node<T, V>* node) {
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+void AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::UpdateSize(
+    Node<T, V>* node) {
+  // Children are always up to date: Balance runs bottom-up and rotations
+  // refresh the demoted node first. The aggregate rides along.
   if (node) {
     node->size_ = 1 + Size(node->left) + Size(node->right);
-    UpdateSize(node->left);
-    UpdateSize(node->right);
+    if constexpr (kAggregated) {
+      static_cast<stored_node*>(node)->aggregate = Aggregate::Combine(
+          Aggregate::Combine(AggregateOf(node->left),
+                             Aggregate::Lift(node->key)),
+          AggregateOf(node->right));
+    }
+  }
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+auto AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::AggregateOf(
+    Node<T, V>* node) {
+  if (node) {
+    return static_cast<stored_node*>(node)->aggregate;
   }
+  return Aggregate::Identity();
 }
-template <typename T, typename V>
-int AVLTree<T, V>::Size(Node<T, V>* node) {
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+int AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Size(Node<T, V>* node) {
   if (node) {
     return node->size_;
   }
   return 0;
 }
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::Insert(T key) {
-  root = Insert(root, key, nullptr);
-  return root;
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Insert(
+    const T& key) {
+  this->BeginUpdate();
+  Node<T, V>* node =
+      InsertUnique(key, comp_, [this, &key] { return CreateNode(key); });
+  this->EndUpdate();
+  return node;
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+template <typename... Args>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Emplace(
+    Args&&... args) {
+  Node<T, V>* node = CreateNode(std::forward<Args>(args)...);
+  Node<T, V>* found = nullptr;
+  this->BeginUpdate();
+  try {
+    found = InsertUnique(node->key, comp_, [node] { return node; });
+  } catch (...) {
+    DestroyNode(node);
+    throw;
+  }
+  this->EndUpdate();
+  if (!inserted) DestroyNode(node);
+  return found;
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+template <typename K, typename Less, typename... Args>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::EmplaceUnique(
+    const K& key, Less less, Args&&... args) {
+  this->BeginUpdate();
+  Node<T, V>* node = InsertUnique(key, less, [&] {
+    return CreateNode(std::forward<Args>(args)...);
+  });
+  this->EndUpdate();
+  return node;
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+Node<T, V>*
+AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::InsertMulti(const T& key) {
+  return LinkMulti(key, [this, &key] { return CreateNode(key); });
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::InsertNodeMulti(
+    Node<T, V>* node) {
+  node->left = nullptr;
+  node->right = nullptr;
+  node->height = 1;
+  node->size_ = 1;
+  LinkMulti(node->key, [node] { return node; });
+  this->TrackAcquire(sizeof(stored_node));
+  return node;
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+template <typename Make>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::LinkMulti(
+    const T& key, Make make) {
+  Node<T, V>* parent = nullptr;
+  bool left = false;
+  for (Node<T, V>* node = root; node;) {
+    parent = node;
+    left = comp_(key, node->key);
+    node = left ? node->left : node->right;
+  }
+  Node<T, V>* created = make();
+  created->parent = parent;
+  if (!parent) {
+    root = created;
+  } else {
+    (left ? parent->left : parent->right) = created;
+  }
+  this->BeginUpdate();
+  Retrace(created);
+  this->EndUpdate();
+  inserted = true;
+  return created;
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+void AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Remove(const T& key) {
+  if (Node<T, V>* node = Lookup(key)) Erase(node);
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+void AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Erase(
+    Node<T, V>* node) {
+  Unlink(node);
+  DestroyNode(node);
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+template <typename Drop>
+size_t AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::EraseIf(Drop drop) {
+  auto by_key = [&drop](Node<T, V>* node) { return drop(node->key); };
+  size_t erased = 0;
+  std::exception_ptr error;
+  SetRoot(Filter(root, by_key, erased, error));
+  if (error) std::rethrow_exception(error);
+  return erased;
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+size_t AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::EraseRange(
+    Node<T, V>* first, Node<T, V>* last) {
+  if (!first || first == last) return 0;
+  const size_t from = Rank(first);
+  const size_t to = last ? Rank(last) : root->size_;
+  auto [before, rest] = Split(root, from);
+  auto [range, after] = Split(rest, to - from);
+  Clear(range);
+  SetRoot(Join(before, after));
+  return to - from;
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+template <typename Drop>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Filter(
+    Node<T, V>* node, Drop& drop, size_t& erased, std::exception_ptr& error) {
+  // Post-order, but `drop` is asked in key order. Both subtrees come back
+  // balanced, so joining them costs their height difference, which only
+  // grows where much was erased.
+  if (!node) return nullptr;
+  Node<T, V>* left = Filter(node->left, drop, erased, error);
+  bool dropped = false;
+  if (!error) {
+    try {
+      dropped = drop(node);
+    } catch (...) {
+      error = std::current_exception();
+    }
+  }
+  Node<T, V>* right = Filter(node->right, drop, erased, error);
+  if (!dropped) return Join(left, node, right);
+  DestroyNode(node);
+  ++erased;
+  return Join(left, right);
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Join(
+    Node<T, V>* left, Node<T, V>* mid, Node<T, V>* right) {
+  // Walk down the spine of the taller side to a subtree no more than one
+  // level taller than the other side, hang `mid` there and rebalance on
+  // the way back: each level needs at most one (double) rotation.
+  const int hl = Height(left);
+  const int hr = Height(right);
+  if (hl > hr + 1) {
+    left->right = Join(left->right, mid, right);
+    left->right->parent = left;
+    return Balance(left);
+  }
+  if (hr > hl + 1) {
+    right->left = Join(left, mid, right->left);
+    right->left->parent = right;
+    return Balance(right);
+  }
+  mid->left = left;
+  mid->right = right;
+  if (left) left->parent = mid;
+  if (right) right->parent = mid;
+  UpdateHeight(mid);
+  UpdateSize(mid);
+  return mid;
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Join(
+    Node<T, V>* left, Node<T, V>* right) {
+  if (!left) return right;
+  if (!right) return left;
+  Node<T, V>* min = FindMin(right);
+  return Join(left, min, RemoveMin(right));
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+std::pair<Node<T, V>*, Node<T, V>*>
+AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Split(Node<T, V>* node,
+                                                    size_t count) {
+  if (!node) return {nullptr, nullptr};
+  const size_t left_size = Size(node->left);
+  if (count <= left_size) {
+    auto [before, rest] = Split(node->left, count);
+    return {before, Join(rest, node, node->right)};
+  }
+  auto [rest, after] = Split(node->right, count - left_size - 1);
+  return {Join(node->left, node, rest), after};
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+size_t
+AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Rank(Node<T, V>* node) {
+  size_t rank = Size(node->left);
+  for (; node->parent; node = node->parent) {
+    if (node == node->parent->right) rank += Size(node->parent->left) + 1;
+  }
+  return rank;
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Extract(
+    Node<T, V>* node) {
+  Unlink(node);
+  this->TrackRelease(sizeof(stored_node));
+  return node;
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::InsertNode(
+    Node<T, V>* node) {
+  node->left = nullptr;
+  node->right = nullptr;
+  node->height = 1;
+  node->size_ = 1;
+  this->BeginUpdate();
+  Node<T, V>* found =
+      InsertUnique(node->key, comp_, [node] { return node; });
+  this->EndUpdate();
+  if (inserted) this->TrackAcquire(sizeof(stored_node));
+  return found;
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+void AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::DestroyDetached(
+    const Allocator& alloc, Node<T, V>* node) {
+  node_allocator node_alloc(alloc);
+  FreeNode(node_alloc, node);
+  AVLTree::TrackOrphanDeallocate(sizeof(stored_node));
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+void AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Unlink(
+    Node<T, V>* node) {
+  Node<T, V>* parent = node->parent;
+  const bool left = parent && parent->left == node;
+  this->BeginUpdate();
+  Node<T, V>* replacement = Detach(node);
+  if (!parent) {
+    root = replacement;
+  } else {
+    (left ? parent->left : parent->right) = replacement;
+    Retrace(parent);
+  }
+  this->EndUpdate();
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Search(
+    const T& key) {
+  this->BeginSearch();
+  Node<T, V>* node = Lookup(key);
+  this->EndSearch();
+  return node;
 }
-template <typename T, typename V>
-void AVLTree<T, V>::Remove(T key) {
-  root = Remove(root, key);
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+template <typename Before>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::PartitionPoint(
+    Before before) {
+  this->BeginSearch();
+  Node<T, V>* found = nullptr;
+  Node<T, V>* node = root;
+  while (node) {
+    this->OnSearchStep();
+    if (before(node->key)) {
+      node = node->right;
+    } else {
+      found = node;
+      node = node->left;
+    }
+  }
+  this->EndSearch();
+  return found;
 }
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::Search(T key) {
-  return Search(root, key);
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+template <typename Before>
+size_t
+AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::CountBefore(Before before) {
+  size_t count = 0;
+  Node<T, V>* node = root;
+  while (node) {
+    if (before(node->key)) {
+      count += Size(node->left) + 1;
+      node = node->right;
+    } else {
+      node = node->left;
+    }
+  }
+  return count;
 }
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::GetRoot() const {
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+template <typename Before, typename BeforeEnd>
+auto AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Fold(
+    Before from, BeforeEnd to) {
+  static_assert(kAggregated, "Fold needs an Aggregate policy");
+  // Descend to the highest node inside the range; below it the range is a
+  // suffix of its left subtree plus a prefix of its right one.
+  Node<T, V>* split = root;
+  while (split) {
+    if (from(split->key)) {
+      split = split->right;
+    } else if (!to(split->key)) {
+      split = split->left;
+    } else {
+      break;
+    }
+  }
+  if (!split) return Aggregate::Identity();
+  // Whole right subtrees of nodes in the range, collected right to left.
+  auto suffix = Aggregate::Identity();
+  for (Node<T, V>* node = split->left; node;) {
+    if (from(node->key)) {
+      node = node->right;
+    } else {
+      suffix = Aggregate::Combine(
+          Aggregate::Combine(Aggregate::Lift(node->key),
+                             AggregateOf(node->right)),
+          suffix);
+      node = node->left;
+    }
+  }
+  // And whole left subtrees, collected left to right.
+  auto prefix = Aggregate::Identity();
+  for (Node<T, V>* node = split->right; node;) {
+    if (to(node->key)) {
+      prefix = Aggregate::Combine(
+          prefix, Aggregate::Combine(AggregateOf(node->left),
+                                     Aggregate::Lift(node->key)));
+      node = node->right;
+    } else {
+      node = node->left;
+    }
+  }
+  return Aggregate::Combine(
+      Aggregate::Combine(suffix, Aggregate::Lift(split->key)), prefix);
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+void AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Refresh(
+    Node<T, V>* node) {
+  if constexpr (kAggregated) {
+    for (; node; node = node->parent) UpdateSize(node);
+  }
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::GetRoot() const {
   return this->root;
 }
-template <typename T, typename V>
-void AVLTree<T, V>::Swap(AVLTree<T, V>& other) {
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+void AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Swap(AVLTree& other) {
+  if constexpr (node_traits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
   std::swap(root, other.root);
+  std::swap(comp_, other.comp_);
+  this->TrackSwap(other);
 }
-template <typename T, typename V>
-bool AVLTree<T, V>::GetInserted() {
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+bool AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::GetInserted() {
   return inserted;
 }
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::CopyTree(Node<T, V>* node) {
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::CopyTree(
+    Node<T, V>* node, Node<T, V>* parent) {
   if (node == nullptr) {
     return nullptr;
   }
-  Node<T, V>* new_node = new Node<T, V>(node->key);
-  new_node->size_ = node->size_;
-  new_node->left = CopyTree(node->left);
-  new_node->right = CopyTree(node->right);
-  new_node->parent = node->parent;
-  return new_node;
+  Node<T, V>* top = nullptr;
+  if (ThreadPool* pool = PoolFor(node)) {
+    top = CopyParallel(*pool, node);
+  } else {
+    top = CopySubtree(alloc_, node);
+  }
+  top->parent = parent;
+  this->TrackAllocate(sizeof(stored_node) * top->size_, top->size_);
+  return top;
 }
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::MaximumKey(Node<T, V>* node) {
-  if (node != nullptr) {
-    while (node->right != nullptr) {
-      return this->MaximumKey(node->right);
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+template <bool kMove>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::CopySubtree(
+    node_allocator& alloc, Node<T, V>* node) {
+  // Walks both trees in step, pre-order, with the parent links: a copy
+  // still has null where its source has a child not yet copied.
+  Node<T, V>* top = CopyNode<kMove>(alloc, node);
+  try {
+    Node<T, V>* from = node;
+    Node<T, V>* to = top;
+    while (true) {
+      if (from->left && !to->left) {
+        to->left = CopyNode<kMove>(alloc, from->left);
+        to->left->parent = to;
+        from = from->left;
+        to = to->left;
+      } else if (from->right && !to->right) {
+        to->right = CopyNode<kMove>(alloc, from->right);
+        to->right->parent = to;
+        from = from->right;
+        to = to->right;
+      } else if (from == node) {
+        return top;
+      } else {
+        from = from->parent;
+        to = to->parent;
+      }
+    }
+  } catch (...) {
+    FreeSubtree(alloc, top);
+    throw;
+  }
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::CopyParallel(
+    ThreadPool& pool, Node<T, V>* node) {
+  // Copy the top levels here, breadth-first, until there are enough nodes
+  // whose two subtrees the pool can copy and hang under their copies.
+  const size_t tasks = 4 * pool.concurrency();
+  Node<T, V>* top = CopyNode(alloc_, node);
+  try {
+    Vector<Node<T, V>*> from;
+    Vector<Node<T, V>*> to;
+    from.push_back(node);
+    to.push_back(top);
+    while (from.size() < tasks) {
+      Vector<Node<T, V>*> next_from;
+      Vector<Node<T, V>*> next_to;
+      for (size_t i = 0; i < from.size(); ++i) {
+        if (Node<T, V>* left = from[i]->left) {
+          to[i]->left = CopyNode(alloc_, left);
+          to[i]->left->parent = to[i];
+          next_from.push_back(left);
+          next_to.push_back(to[i]->left);
+        }
+        if (Node<T, V>* right = from[i]->right) {
+          to[i]->right = CopyNode(alloc_, right);
+          to[i]->right->parent = to[i];
+          next_from.push_back(right);
+          next_to.push_back(to[i]->right);
+        }
+      }
+      if (next_from.empty()) return top;
+      from.swap(next_from);
+      to.swap(next_to);
     }
-    return node;
+    pool.parallel_for(from.size(), [this, &from, &to](size_t i) {
+      node_allocator alloc(alloc_);
+      if (from[i]->left) {
+        to[i]->left = CopySubtree(alloc, from[i]->left);
+        to[i]->left->parent = to[i];
+      }
+      if (from[i]->right) {
+        to[i]->right = CopySubtree(alloc, from[i]->right);
+        to[i]->right->parent = to[i];
+      }
+    });
+  } catch (...) {
+    FreeSubtree(alloc_, top);
+    throw;
+  }
+  return top;
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+template <bool kMove>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::CopyNode(
+    node_allocator& alloc, Node<T, V>* node) {
+  Node<T, V>* copy = nullptr;
+  if constexpr (kMove) {
+    copy = MakeNode(alloc, std::move(node->key));
+  } else {
+    copy = MakeNode(alloc, node->key);
+  }
+  copy->size_ = node->size_;
+  copy->height = node->height;
+  if constexpr (kAggregated) {
+    static_cast<stored_node*>(copy)->aggregate = AggregateOf(node);
+  }
+  return copy;
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+ThreadPool* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::PoolFor(
+    Node<T, V>* node) const {
+  if constexpr (kParallel) {
+    if (node) return tree_parallel::pool_for(node->size_);
   }
   return nullptr;
 }
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::GetNil() {
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::MaximumKey(
+    Node<T, V>* node) {
+  if (node != nullptr) {
+    while (node->right != nullptr) node = node->right;
+  }
+  return node;
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+TreeStats AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::Stats() const {
+  TreeStats stats;
+  stats.counters = Counters();
+  if (!root) return stats;
+  stats.size = root->size_;
+  stats.height = root->height;
+  for (int depth = 0; depth < root->height; ++depth) {
+    stats.depth_histogram.push_back(0);
+  }
+  Vector<std::pair<const Node<T, V>*, int>> stack;
+  stack.push_back({root, 0});
+  while (!stack.empty()) {
+    auto [node, depth] = stack.back();
+    stack.pop_back();
+    ++stats.depth_histogram[depth];
+    if (node->left) stack.push_back({node->left, depth + 1});
+    if (node->right) stack.push_back({node->right, depth + 1});
+  }
+  return stats;
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::GetNil() {
   return nil;
 }
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+typename AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::allocator_type
+AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::GetAllocator() const {
+  return allocator_type(alloc_);
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+Compare AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::GetCompare() const {
+  return comp_;
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+size_t AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::MaxSize() const {
+  return node_traits::max_size(alloc_);
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+template <typename... Args>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::CreateNode(
+    Args&&... args) {
+  Node<T, V>* node = MakeNode(alloc_, std::forward<Args>(args)...);
+  this->TrackAllocate(sizeof(stored_node));
+  return node;
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+void AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::DestroyNode(
+    Node<T, V>* node) {
+  FreeNode(alloc_, node);
+  this->TrackDeallocate(sizeof(stored_node));
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+template <typename... Args>
+Node<T, V>* AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::MakeNode(
+    node_allocator& alloc, Args&&... args) {
+  stored_node* node = node_traits::allocate(alloc, 1);
+  try {
+    node_traits::construct(alloc, node, std::in_place,
+                           std::forward<Args>(args)...);
+  } catch (...) {
+    node_traits::deallocate(alloc, node, 1);
+    throw;
+  }
+  return node;
+}
+template <typename T, typename V, typename Allocator, typename Aggregate,
+          typename Compare, typename Tag>
+void AVLTree<T, V, Allocator, Aggregate, Compare, Tag>::FreeNode(
+    node_allocator& alloc, Node<T, V>* node) {
+  stored_node* stored = static_cast<stored_node*>(node);
+  node_traits::destroy(alloc, stored);
+  node_traits::deallocate(alloc, stored, 1);
+}
 }  // namespace s21
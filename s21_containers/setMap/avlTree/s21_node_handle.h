@@ -0,0 +1,71 @@
+#ifndef SRC_NODE_HANDLE_H_
+#define SRC_NODE_HANDLE_H_
+
+#include <optional>
+#include <utility>
+
+#include "s21_avl_tree.h"
+
+namespace s21 {
+// Owns one node that extract() took out of a Set or Map, so that it can be
+// inserted into another container of the same type without being freed
+// and allocated again. Dropping a non-empty handle frees the node.
+template <typename T, typename V, typename Tree>
+class NodeHandle {
+ public:
+  using allocator_type = typename Tree::allocator_type;
+
+  NodeHandle() = default;
+  NodeHandle(Node<T, V>* node, const allocator_type& alloc)
+      : node_(node), alloc_(alloc) {}
+  NodeHandle(NodeHandle&& other) noexcept
+      : node_(std::exchange(other.node_, nullptr)),
+        alloc_(std::move(other.alloc_)) {}
+  NodeHandle& operator=(NodeHandle&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      node_ = std::exchange(other.node_, nullptr);
+      // Rebuilt rather than assigned: pmr allocators cannot be assigned.
+      alloc_.reset();
+      if (other.alloc_) alloc_.emplace(*other.alloc_);
+      other.alloc_.reset();
+    }
+    return *this;
+  }
+  ~NodeHandle() { Reset(); }
+
+  bool empty() const noexcept { return node_ == nullptr; }
+  explicit operator bool() const noexcept { return node_ != nullptr; }
+  allocator_type get_allocator() const { return *alloc_; }
+
+  // The element, for Set handles.
+  T& value() const { return node_->key; }
+  // Key and mapped value, for Map handles.
+  const auto& key() const { return node_->key.first; }
+  auto& mapped() const { return node_->key.second; }
+
+  Node<T, V>* GetNode() const { return node_; }
+  // Gives up ownership to the container the node was linked into.
+  Node<T, V>* Release() { return std::exchange(node_, nullptr); }
+
+ private:
+  void Reset() {
+    if (node_) Tree::DestroyDetached(*alloc_, std::exchange(node_, nullptr));
+  }
+
+  Node<T, V>* node_ = nullptr;
+  // Allocators need not be default-constructible; empty handles have none.
+  std::optional<allocator_type> alloc_;
+};
+
+// What insert(node_type&&) returns: where the key now lives, whether the
+// handle's node was linked, and the node back when it was not.
+template <typename Iterator, typename NodeType>
+struct InsertReturn {
+  Iterator position;
+  bool inserted;
+  NodeType node;
+};
+}  // namespace s21
+
+#endif  // SRC_NODE_HANDLE_H_
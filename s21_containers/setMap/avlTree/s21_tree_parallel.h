@@ -0,0 +1,54 @@
+#ifndef SRC_TREE_PARALLEL_H_
+#define SRC_TREE_PARALLEL_H_
+
+#include <atomic>
+#include <cstddef>
+
+#include "../../concurrency/thread_pool.h"
+
+// Parallel copy and teardown of large AVL trees. Once enabled, copying or
+// clearing (and so destroying) a Set, Map or other AVL-based container of
+// at least `threshold` nodes cuts the tree a few levels below its root and
+// copies or frees the subtrees there as one parallel_for on `pool`.
+// Element copies and destructors then run on pool threads. Only trees
+// whose allocator is stateless (is_always_equal) take part: a stateful
+// one, a pmr resource say, need not be safe to share between threads.
+// The pool must outlive every tree copied or cleared while enabled; a
+// Guard declared after it disables again before it is destroyed.
+namespace s21 {
+namespace tree_parallel {
+namespace detail {
+inline std::atomic<ThreadPool *> pool{nullptr};
+inline std::atomic<std::size_t> threshold{0};
+}  // namespace detail
+
+inline void enable(ThreadPool &pool, std::size_t threshold) {
+  detail::threshold.store(threshold, std::memory_order_relaxed);
+  detail::pool.store(&pool, std::memory_order_release);
+}
+
+inline void disable() {
+  detail::pool.store(nullptr, std::memory_order_release);
+}
+
+/// Enables parallel copy and teardown for its lifetime, so an early
+/// return cannot leave a dangling pool installed.
+class Guard {
+ public:
+  Guard(ThreadPool &pool, std::size_t threshold) { enable(pool, threshold); }
+  Guard(const Guard &) = delete;
+  ~Guard() { disable(); }
+  Guard &operator=(const Guard &) = delete;
+};
+
+/// The pool for a tree of `size` nodes, or nullptr to stay on this thread.
+inline ThreadPool *pool_for(std::size_t size) {
+  ThreadPool *pool = detail::pool.load(std::memory_order_acquire);
+  if (!pool || pool->concurrency() < 2) return nullptr;
+  return size >= detail::threshold.load(std::memory_order_relaxed) ? pool
+                                                                   : nullptr;
+}
+}  // namespace tree_parallel
+}  // namespace s21
+
+#endif  // SRC_TREE_PARALLEL_H_
@@ -0,0 +1,123 @@
+#ifndef SRC_TREE_STATS_H_
+#define SRC_TREE_STATS_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include "../../vector/vector.h"
+
+// Operation counters of AVLTree. Build with -DS21_TREE_STATS (make
+// TREE_STATS=1, cmake -DS21_TREE_STATS=ON) to count rotations, Search
+// descents and rebalance paths; without it TreeProbe is an empty base and
+// the hooks compile to nothing. The shape part of TreeStats is always
+// available.
+namespace s21 {
+struct TreeCounters {
+  size_t rotations_left = 0;
+  size_t rotations_right = 0;
+  // Search calls and the nodes each one visited.
+  size_t searches = 0;
+  size_t search_depth_total = 0;
+  size_t search_depth_max = 0;
+  // Insert/Remove calls and the nodes on their way back up whose height
+  // changed or that were rotated.
+  size_t updates = 0;
+  size_t rebalance_path_total = 0;
+  size_t rebalance_path_max = 0;
+
+  size_t rotations() const { return rotations_left + rotations_right; }
+  double average_search_depth() const {
+    return searches ? double(search_depth_total) / searches : 0.0;
+  }
+  double average_rebalance_path() const {
+    return updates ? double(rebalance_path_total) / updates : 0.0;
+  }
+};
+
+struct TreeStats {
+  size_t size = 0;
+  int height = 0;
+  // Nodes per depth, the root at depth 0.
+  Vector<size_t> depth_histogram;
+  TreeCounters counters;
+
+  // Worst-case AVL height for this size: 1.4405 * log2(n + 2) - 0.3277.
+  double height_bound() const {
+    return 1.4405 * std::log2(double(size) + 2) - 0.3277;
+  }
+};
+
+// Private base of AVLTree; counters stay with the tree they were taken on.
+class TreeProbe {
+ public:
+  TreeCounters Counters() const {
+#ifdef S21_TREE_STATS
+    return counters_;
+#else
+    return TreeCounters();
+#endif
+  }
+
+ protected:
+  TreeProbe() = default;
+  TreeProbe(const TreeProbe&) noexcept {}
+  TreeProbe& operator=(const TreeProbe&) noexcept { return *this; }
+  ~TreeProbe() = default;
+
+  void OnRotateLeft() {
+#ifdef S21_TREE_STATS
+    ++counters_.rotations_left;
+#endif
+  }
+  void OnRotateRight() {
+#ifdef S21_TREE_STATS
+    ++counters_.rotations_right;
+#endif
+  }
+  void BeginSearch() {
+#ifdef S21_TREE_STATS
+    depth_ = 0;
+#endif
+  }
+  void OnSearchStep() {
+#ifdef S21_TREE_STATS
+    ++depth_;
+#endif
+  }
+  void EndSearch() {
+#ifdef S21_TREE_STATS
+    ++counters_.searches;
+    counters_.search_depth_total += depth_;
+    counters_.search_depth_max = std::max(counters_.search_depth_max, depth_);
+#endif
+  }
+  void BeginUpdate() {
+#ifdef S21_TREE_STATS
+    path_ = 0;
+#endif
+  }
+  void OnRebalanceStep() {
+#ifdef S21_TREE_STATS
+    ++path_;
+#endif
+  }
+  void EndUpdate() {
+#ifdef S21_TREE_STATS
+    ++counters_.updates;
+    counters_.rebalance_path_total += path_;
+    counters_.rebalance_path_max =
+        std::max(counters_.rebalance_path_max, path_);
+#endif
+  }
+
+#ifdef S21_TREE_STATS
+ private:
+  TreeCounters counters_;
+  size_t depth_ = 0;
+  size_t path_ = 0;
+#endif
+};
+}  // namespace s21
+
+#endif  // SRC_TREE_STATS_H_
@@ -0,0 +1,151 @@
+#ifndef SRC_CONCURRENT_MAP_H_
+#define SRC_CONCURRENT_MAP_H_
+
+#include <atomic>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "../../concurrency/epoch.h"
+#include "../../memory/memory_resource.h"
+#include "../persistent/s21_persistent_map.h"
+
+namespace s21 {
+// Map for read-mostly sharing between threads, RCU style. The contents are
+// an immutable PersistentMap version behind an atomic pointer: readers pin
+// an epoch and search it without locks or shared counters, while writers,
+// serialized by a mutex, path-copy the next version and publish it with
+// one store. A replaced version, with the nodes only it referenced, is
+// handed to s21::epoch and freed once no reader can still be inside it.
+//
+// Lookups return copies, because the version they read may be reclaimed
+// as soon as they return; snapshot() keeps one version alive to iterate
+// or to run several lookups against. With an allocator drawing from a
+// memory resource, call epoch::synchronize() after destroying the map and
+// before destroying the resource.
+template <typename K, typename V,
+          typename Allocator = std::allocator<std::pair<const K, V>>>
+class ConcurrentMap {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+  using snapshot_type = PersistentMap<K, V, Allocator>;
+
+  ConcurrentMap() : ConcurrentMap(Allocator()) {}
+  explicit ConcurrentMap(const Allocator& alloc)
+      : alloc_(alloc), current_(MakeVersion(snapshot_type(alloc))) {}
+  ConcurrentMap(std::initializer_list<value_type> const& items,
+                const Allocator& alloc = Allocator())
+      : alloc_(alloc), current_(MakeVersion(snapshot_type(items, alloc))) {}
+  ConcurrentMap(const ConcurrentMap&) = delete;
+  ConcurrentMap& operator=(const ConcurrentMap&) = delete;
+  // No reader may still be using the map.
+  ~ConcurrentMap() { Reclaim(current_.load(std::memory_order_relaxed)); }
+
+  // Runs fn on the current version under an epoch guard and returns its
+  // result, which must not refer into the version.
+  template <class Fn>
+  auto read(Fn fn) const {
+    epoch::Guard guard;
+    return fn(static_cast<const snapshot_type&>(
+        current_.load(std::memory_order_acquire)->map));
+  }
+
+  mapped_type at(const key_type& key) const {
+    return read([&key](const snapshot_type& m) { return m.at(key); });
+  }
+  bool contains(const key_type& key) const {
+    return read([&key](const snapshot_type& m) { return m.contains(key); });
+  }
+  bool empty() const { return size() == 0; }
+  size_type size() const {
+    return read([](const snapshot_type& m) { return m.size(); });
+  }
+  size_type max_size() const {
+    return read([](const snapshot_type& m) { return m.max_size(); });
+  }
+  // The current version, kept alive by the returned handle.
+  snapshot_type snapshot() const {
+    return read([](const snapshot_type& m) { return m; });
+  }
+  allocator_type get_allocator() const { return allocator_type(alloc_); }
+
+  // Writers. Each publishes at most one new version; readers see either
+  // all of an update or none of it.
+  bool insert(const key_type& key, const mapped_type& obj) {
+    return apply([&](const snapshot_type& m) { return m.insert(key, obj); });
+  }
+  void insert_or_assign(const key_type& key, const mapped_type& obj) {
+    apply([&](const snapshot_type& m) {
+      return m.insert_or_assign(key, obj);
+    });
+  }
+  size_type erase(const key_type& key) {
+    return apply([&key](const snapshot_type& m) { return m.erase(key); });
+  }
+  void clear() {
+    apply([this](const snapshot_type&) {
+      return snapshot_type(get_allocator());
+    });
+  }
+  // Publishes fn(current) as the next version, so a batch of updates
+  // becomes visible at once. Returns false when fn left the version as it
+  // was. fn runs under the writer lock and must not write to this map.
+  template <class Fn>
+  bool apply(Fn fn) {
+    Version* old;
+    {
+      std::lock_guard<std::mutex> lock(write_mutex_);
+      old = current_.load(std::memory_order_relaxed);
+      snapshot_type next = fn(static_cast<const snapshot_type&>(old->map));
+      if (next.shares_root(old->map)) return false;
+      current_.store(MakeVersion(std::move(next)), std::memory_order_release);
+    }
+    epoch::retire(old, &Reclaim);
+    return true;
+  }
+
+ private:
+  struct Version {
+    explicit Version(snapshot_type&& m) : map(std::move(m)) {}
+    snapshot_type map;
+  };
+  using version_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Version>;
+  using version_traits = std::allocator_traits<version_allocator>;
+
+  Version* MakeVersion(snapshot_type&& map) {
+    Version* version = version_traits::allocate(alloc_, 1);
+    version_traits::construct(alloc_, version, std::move(map));
+    return version;
+  }
+  // Frees with the allocator the version's map was built with.
+  static void Reclaim(void* p) {
+    Version* version = static_cast<Version*>(p);
+    version_allocator alloc(version->map.get_allocator());
+    version_traits::destroy(alloc, version);
+    version_traits::deallocate(alloc, version, 1);
+  }
+
+  version_allocator alloc_;
+  std::atomic<Version*> current_;
+  std::mutex write_mutex_;
+};
+
+template class ConcurrentMap<int, int>;
+template class ConcurrentMap<double, double>;
+template class ConcurrentMap<char, char>;
+template class ConcurrentMap<float, float>;
+
+namespace pmr {
+template <typename K, typename V>
+using ConcurrentMap =
+    s21::ConcurrentMap<K, V, PolymorphicAllocator<std::pair<const K, V>>>;
+}  // namespace pmr
+}  // namespace s21
+
+#endif  // SRC_CONCURRENT_MAP_H_
@@ -0,0 +1,176 @@
+#ifndef SRC_CONCURRENT_SET_H_
+#define SRC_CONCURRENT_SET_H_
+
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#include "../../concurrency/epoch.h"
+#include "../../memory/memory_resource.h"
+
+namespace s21 {
+// Ordered set that any number of threads may insert into, erase from and
+// read at once: a lock-free skip list after Herlihy and Shavit. Erase
+// marks a node's links, top level first, and the mark on level 0 decides
+// which erase took the key; any later search that meets a marked node
+// unlinks it. Every node counts the levels it is linked at, and whoever
+// unlinks its last level hands it to s21::epoch, so readers may walk
+// nodes that are being erased.
+//
+// Iterators carry an epoch::Guard and must stay on the thread that made
+// them; while any is alive no memory is reclaimed. Iteration is weakly
+// consistent: it visits keys in order, never one twice, and every key
+// present for the whole walk. size() is exact only when nothing runs
+// concurrently. With an allocator drawing from a memory resource, call
+// epoch::synchronize() after destroying the set and before the resource.
+template <typename T, typename Allocator = std::allocator<T>>
+class ConcurrentSet {
+  struct Node;
+
+ public:
+  using key_type = T;
+  using value_type = T;
+  using reference = const T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  class ConstIterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    ConstIterator() : node_(nullptr) {}
+
+    reference operator*() const { return node_->key; }
+    pointer operator->() const { return &node_->key; }
+    ConstIterator& operator++() {
+      node_ = NextLive(node_);
+      return *this;
+    }
+    ConstIterator operator++(int) {
+      ConstIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    bool operator==(const ConstIterator& other) const {
+      return node_ == other.node_;
+    }
+    bool operator!=(const ConstIterator& other) const {
+      return node_ != other.node_;
+    }
+
+   private:
+    friend class ConcurrentSet;
+    explicit ConstIterator(Node* node) : node_(node) {}
+
+    epoch::Guard guard_;
+    Node* node_;
+  };
+  using const_iterator = ConstIterator;
+  using iterator = const_iterator;
+
+  ConcurrentSet();
+  explicit ConcurrentSet(const Allocator& alloc);
+  ConcurrentSet(std::initializer_list<value_type> const& items,
+                const Allocator& alloc = Allocator());
+  ConcurrentSet(const ConcurrentSet&) = delete;
+  ConcurrentSet& operator=(const ConcurrentSet&) = delete;
+  // No other thread may still be using the set.
+  ~ConcurrentSet();
+
+  iterator begin() const;
+  iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  // Erases the keys one at a time; not atomic.
+  void clear();
+  std::pair<iterator, bool> insert(const T& value);
+  void erase(iterator pos);
+  // 1 when this call erased the key, 0 when it was absent or another
+  // thread erased it first.
+  size_type erase(const T& key);
+
+  bool contains(const T& key) const;
+  iterator find(const T& key) const;
+  // First key not less than `key`.
+  iterator lower_bound(const T& key) const;
+  allocator_type get_allocator() const;
+
+ private:
+  static constexpr int kMaxHeight = 32;
+  static constexpr std::uintptr_t kMarked = 1;
+
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+  using Link = std::atomic<std::uintptr_t>;
+
+  // The node's tower of `height` links follows it in the same block. Each
+  // node keeps the allocator that made it, so the epoch domain can free it
+  // after the set is gone.
+  struct alignas(Link) Node : node_allocator {
+    Node(const node_allocator& alloc, const T& value, int levels)
+        : node_allocator(alloc), key(value), height(levels), links(1) {}
+
+    Link* Next() { return reinterpret_cast<Link*>(this + 1); }
+
+    const T key;
+    const int height;
+    // Levels the node is linked at; the one that drops it to 0 retires.
+    std::atomic<int> links;
+  };
+
+  static Node* Ptr(std::uintptr_t link) {
+    return reinterpret_cast<Node*>(link & ~kMarked);
+  }
+  static std::uintptr_t Pack(Node* node) {
+    return reinterpret_cast<std::uintptr_t>(node);
+  }
+  static bool Marked(std::uintptr_t link) { return link & kMarked; }
+  static size_type Units(int height);
+  static int RandomHeight();
+  static Node* NextLive(Node* node);
+  static void Reclaim(void* p);
+
+  Link& LinkOf(Node* pred, int level) const {
+    return pred ? pred->Next()[level] : head_[level];
+  }
+  Node* MakeNode(const T& value, int height);
+  // Fills the last node before `key` and the first at or after it on every
+  // level, unlinking marked nodes on the way; true if the latter holds
+  // `key`.
+  bool Find(const T& key, Node** preds, Node** succs);
+  // First unmarked node not less than `key`, without writing anything.
+  Node* Locate(const T& key) const;
+  void Unlinked(Node* node);
+
+  node_allocator alloc_;
+  mutable Link head_[kMaxHeight];
+  std::atomic<int> top_;  // Height of the tallest node ever inserted.
+  std::atomic<size_type> size_;
+};
+
+template class ConcurrentSet<int>;
+template class ConcurrentSet<double>;
+template class ConcurrentSet<char>;
+template class ConcurrentSet<float>;
+
+namespace pmr {
+template <typename T>
+using ConcurrentSet = s21::ConcurrentSet<T, PolymorphicAllocator<T>>;
+}  // namespace pmr
+}  // namespace s21
+
+#include "s21_concurrent_set.tpp"
+
+#endif  // SRC_CONCURRENT_SET_H_
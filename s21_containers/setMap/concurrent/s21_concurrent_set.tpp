@@ -0,0 +1,314 @@
+#include <new>
+
+#include "s21_concurrent_set.h"
+
+namespace s21 {
+template <typename T, typename A>
+ConcurrentSet<T, A>::ConcurrentSet() : ConcurrentSet(A()) {}
+template <typename T, typename A>
+ConcurrentSet<T, A>::ConcurrentSet(const A& alloc)
+    : alloc_(alloc), top_(1), size_(0) {
+  for (Link& link : head_) link.store(0, std::memory_order_relaxed);
+}
+template <typename T, typename A>
+ConcurrentSet<T, A>::ConcurrentSet(
+    std::initializer_list<value_type> const& items, const A& alloc)
+    : ConcurrentSet(alloc) {
+  for (const auto& item : items) insert(item);
+}
+template <typename T, typename A>
+ConcurrentSet<T, A>::~ConcurrentSet() {
+  // A node may still be linked at some levels and not others, so count
+  // every link away before freeing it. Nodes already unlinked everywhere
+  // belong to the epoch domain.
+  for (int level = kMaxHeight - 1; level >= 0; --level) {
+    Node* node = Ptr(head_[level].load(std::memory_order_relaxed));
+    while (node) {
+      Node* next = Ptr(node->Next()[level].load(std::memory_order_relaxed));
+      if (node->links.fetch_sub(1, std::memory_order_relaxed) == 1) {
+        Reclaim(node);
+      }
+      node = next;
+    }
+  }
+}
+
+template <typename T, typename A>
+typename ConcurrentSet<T, A>::iterator ConcurrentSet<T, A>::begin() const {
+  epoch::Guard guard;
+  Node* first = Ptr(head_[0].load(std::memory_order_acquire));
+  if (first && Marked(first->Next()[0].load(std::memory_order_acquire))) {
+    first = NextLive(first);
+  }
+  return iterator(first);
+}
+template <typename T, typename A>
+typename ConcurrentSet<T, A>::iterator ConcurrentSet<T, A>::end() const {
+  return iterator(nullptr);
+}
+
+template <typename T, typename A>
+bool ConcurrentSet<T, A>::empty() const {
+  return begin() == end();
+}
+template <typename T, typename A>
+typename ConcurrentSet<T, A>::size_type ConcurrentSet<T, A>::size() const {
+  return size_.load(std::memory_order_relaxed);
+}
+template <typename T, typename A>
+typename ConcurrentSet<T, A>::size_type ConcurrentSet<T, A>::max_size()
+    const {
+  return node_traits::max_size(alloc_) / Units(kMaxHeight / 2);
+}
+
+template <typename T, typename A>
+void ConcurrentSet<T, A>::clear() {
+  epoch::Guard guard;
+  for (Node* node = Ptr(head_[0].load(std::memory_order_acquire)); node;
+       node = Ptr(node->Next()[0].load(std::memory_order_acquire))) {
+    erase(node->key);
+  }
+}
+
+template <typename T, typename A>
+std::pair<typename ConcurrentSet<T, A>::iterator, bool>
+ConcurrentSet<T, A>::insert(const T& value) {
+  epoch::Guard guard;
+  Node* preds[kMaxHeight];
+  Node* succs[kMaxHeight];
+  Node* node = nullptr;
+  while (true) {
+    if (Find(value, preds, succs)) {
+      // Never published, so nobody else can hold it.
+      if (node) Reclaim(node);
+      return {iterator(succs[0]), false};
+    }
+    if (!node) node = MakeNode(value, RandomHeight());
+    for (int level = 0; level < node->height; ++level) {
+      node->Next()[level].store(Pack(succs[level]),
+                                std::memory_order_relaxed);
+    }
+    std::uintptr_t expected = Pack(succs[0]);
+    if (LinkOf(preds[0], 0).compare_exchange_strong(
+            expected, Pack(node), std::memory_order_release,
+            std::memory_order_relaxed)) {
+      break;
+    }
+  }
+  size_.fetch_add(1, std::memory_order_relaxed);
+  int top = top_.load(std::memory_order_relaxed);
+  while (top < node->height &&
+         !top_.compare_exchange_weak(top, node->height,
+                                     std::memory_order_relaxed)) {
+  }
+
+  // Upper levels are only shortcuts; stop linking them once an erase has
+  // started marking the node.
+  for (int level = 1; level < node->height; ++level) {
+    while (true) {
+      std::uintptr_t next = node->Next()[level].load(std::memory_order_acquire);
+      if (Marked(next)) return {iterator(node), true};
+      // Only an erase writes a marked link, so a failed exchange means the
+      // node is being erased.
+      if (Ptr(next) != succs[level] &&
+          !node->Next()[level].compare_exchange_strong(
+              next, Pack(succs[level]), std::memory_order_acq_rel)) {
+        return {iterator(node), true};
+      }
+      // An erase may have marked and unlinked the node since the load
+      // above; once its links reach 0 it is retired and stays so.
+      int links = node->links.load(std::memory_order_relaxed);
+      do {
+        if (links == 0) return {iterator(node), true};
+      } while (!node->links.compare_exchange_weak(
+          links, links + 1, std::memory_order_relaxed));
+      std::uintptr_t expected = Pack(succs[level]);
+      if (LinkOf(preds[level], level)
+              .compare_exchange_strong(expected, Pack(node),
+                                       std::memory_order_release,
+                                       std::memory_order_relaxed)) {
+        break;
+      }
+      Unlinked(node);
+      if (!Find(value, preds, succs) || succs[0] != node) {
+        return {iterator(node), true};
+      }
+    }
+  }
+  return {iterator(node), true};
+}
+
+template <typename T, typename A>
+void ConcurrentSet<T, A>::erase(iterator pos) {
+  if (pos != end()) erase(*pos);
+}
+template <typename T, typename A>
+typename ConcurrentSet<T, A>::size_type ConcurrentSet<T, A>::erase(
+    const T& key) {
+  epoch::Guard guard;
+  Node* preds[kMaxHeight];
+  Node* succs[kMaxHeight];
+  if (!Find(key, preds, succs)) return 0;
+  Node* victim = succs[0];
+  for (int level = victim->height - 1; level > 0; --level) {
+    Link& link = victim->Next()[level];
+    std::uintptr_t next = link.load(std::memory_order_relaxed);
+    while (!Marked(next) &&
+           !link.compare_exchange_weak(next, next | kMarked,
+                                       std::memory_order_acq_rel)) {
+    }
+  }
+  Link& link = victim->Next()[0];
+  std::uintptr_t next = link.load(std::memory_order_relaxed);
+  while (true) {
+    if (Marked(next)) return 0;
+    if (link.compare_exchange_weak(next, next | kMarked,
+                                   std::memory_order_acq_rel)) {
+      break;
+    }
+  }
+  size_.fetch_sub(1, std::memory_order_relaxed);
+  Find(key, preds, succs);  // Unlinks the victim wherever still linked.
+  return 1;
+}
+
+template <typename T, typename A>
+bool ConcurrentSet<T, A>::contains(const T& key) const {
+  epoch::Guard guard;
+  Node* node = Locate(key);
+  return node && !(key < node->key);
+}
+template <typename T, typename A>
+typename ConcurrentSet<T, A>::iterator ConcurrentSet<T, A>::find(
+    const T& key) const {
+  epoch::Guard guard;
+  Node* node = Locate(key);
+  return iterator(node && !(key < node->key) ? node : nullptr);
+}
+template <typename T, typename A>
+typename ConcurrentSet<T, A>::iterator ConcurrentSet<T, A>::lower_bound(
+    const T& key) const {
+  epoch::Guard guard;
+  return iterator(Locate(key));
+}
+template <typename T, typename A>
+typename ConcurrentSet<T, A>::allocator_type
+ConcurrentSet<T, A>::get_allocator() const {
+  return allocator_type(alloc_);
+}
+
+template <typename T, typename A>
+typename ConcurrentSet<T, A>::size_type ConcurrentSet<T, A>::Units(
+    int height) {
+  return 1 + (height * sizeof(Link) + sizeof(Node) - 1) / sizeof(Node);
+}
+// Geometric with p = 1/2, from a per-thread xorshift generator.
+template <typename T, typename A>
+int ConcurrentSet<T, A>::RandomHeight() {
+  thread_local std::uint32_t state =
+      0x9E3779B9u ^ static_cast<std::uint32_t>(
+                        reinterpret_cast<std::uintptr_t>(&state) >> 4);
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  int height = 1;
+  for (std::uint32_t bits = state; height < kMaxHeight && (bits & 1);
+       bits >>= 1) {
+    ++height;
+  }
+  return height;
+}
+template <typename T, typename A>
+typename ConcurrentSet<T, A>::Node* ConcurrentSet<T, A>::NextLive(
+    Node* node) {
+  Node* next = Ptr(node->Next()[0].load(std::memory_order_acquire));
+  while (next && Marked(next->Next()[0].load(std::memory_order_acquire))) {
+    next = Ptr(next->Next()[0].load(std::memory_order_acquire));
+  }
+  return next;
+}
+template <typename T, typename A>
+void ConcurrentSet<T, A>::Reclaim(void* p) {
+  Node* node = static_cast<Node*>(p);
+  node_allocator alloc(*node);
+  const size_type units = Units(node->height);
+  node_traits::destroy(alloc, node);
+  node_traits::deallocate(alloc, node, units);
+}
+
+template <typename T, typename A>
+typename ConcurrentSet<T, A>::Node* ConcurrentSet<T, A>::MakeNode(
+    const T& value, int height) {
+  const size_type units = Units(height);
+  Node* node = node_traits::allocate(alloc_, units);
+  try {
+    node_traits::construct(alloc_, node, alloc_, value, height);
+  } catch (...) {
+    node_traits::deallocate(alloc_, node, units);
+    throw;
+  }
+  for (int level = 0; level < height; ++level) {
+    new (node->Next() + level) Link(0);
+  }
+  return node;
+}
+
+template <typename T, typename A>
+bool ConcurrentSet<T, A>::Find(const T& key, Node** preds, Node** succs) {
+retry:
+  Node* pred = nullptr;
+  for (int level = kMaxHeight - 1; level >= 0; --level) {
+    Node* curr = Ptr(LinkOf(pred, level).load(std::memory_order_acquire));
+    while (curr) {
+      std::uintptr_t next = curr->Next()[level].load(std::memory_order_acquire);
+      if (Marked(next)) {
+        std::uintptr_t expected = Pack(curr);
+        if (!LinkOf(pred, level).compare_exchange_strong(
+                expected, Pack(Ptr(next)), std::memory_order_acq_rel)) {
+          goto retry;
+        }
+        Unlinked(curr);
+        curr = Ptr(next);
+      } else if (curr->key < key) {
+        pred = curr;
+        curr = Ptr(next);
+      } else {
+        break;
+      }
+    }
+    preds[level] = pred;
+    succs[level] = curr;
+  }
+  return succs[0] && !(key < succs[0]->key);
+}
+
+template <typename T, typename A>
+typename ConcurrentSet<T, A>::Node* ConcurrentSet<T, A>::Locate(
+    const T& key) const {
+  Node* pred = nullptr;
+  Node* curr = nullptr;
+  for (int level = top_.load(std::memory_order_relaxed) - 1; level >= 0;
+       --level) {
+    curr = Ptr(LinkOf(pred, level).load(std::memory_order_acquire));
+    while (curr) {
+      std::uintptr_t next = curr->Next()[level].load(std::memory_order_acquire);
+      if (Marked(next)) {
+        curr = Ptr(next);
+      } else if (curr->key < key) {
+        pred = curr;
+        curr = Ptr(next);
+      } else {
+        break;
+      }
+    }
+  }
+  return curr;
+}
+
+template <typename T, typename A>
+void ConcurrentSet<T, A>::Unlinked(Node* node) {
+  if (node->links.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    epoch::retire(node, &Reclaim);
+  }
+}
+}  // namespace s21
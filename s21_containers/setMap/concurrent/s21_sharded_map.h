@@ -0,0 +1,161 @@
+#ifndef SRC_SHARDED_MAP_H_
+#define SRC_SHARDED_MAP_H_
+
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "../../concurrency/thread_pool.h"
+#include "../../memory/memory_resource.h"
+#include "../map/s21_map.tpp"
+
+namespace s21 {
+// Map for write-heavy sharing between threads: keys are spread by hash
+// over `Shards` independent Maps, each behind its own mutex, so threads
+// that touch different shards never contend. Every operation locks one
+// shard; size(), clear() and for_each_shard visit them one at a time and
+// are not atomic across shards.
+template <typename K, typename V, size_t Shards = 16,
+          typename Hash = std::hash<K>,
+          typename Allocator = std::allocator<std::pair<const K, V>>>
+class ShardedMap {
+  static_assert(Shards > 0, "ShardedMap needs at least one shard");
+
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using size_type = size_t;
+  using hasher = Hash;
+  using allocator_type = Allocator;
+  using map_type = Map<K, V, std::less<K>, Allocator>;
+
+  ShardedMap() : ShardedMap(Allocator()) {}
+  explicit ShardedMap(const Allocator& alloc, const Hash& hash = Hash())
+      : ShardedMap(alloc, hash, std::make_index_sequence<Shards>()) {}
+  ShardedMap(std::initializer_list<value_type> const& items,
+             const Allocator& alloc = Allocator())
+      : ShardedMap(alloc) {
+    for (const auto& item : items) insert(item.first, item.second);
+  }
+  ShardedMap(const ShardedMap&) = delete;
+  ShardedMap& operator=(const ShardedMap&) = delete;
+
+  // Lookups return copies: the shard is unlocked once they return.
+  mapped_type at(const key_type& key) const {
+    Shard& shard = ShardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.map.at(key);
+  }
+  bool contains(const key_type& key) const {
+    Shard& shard = ShardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.map.contains(key);
+  }
+  bool empty() const { return size() == 0; }
+  size_type size() const {
+    size_type size = 0;
+    for (Shard& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      size += shard.map.size();
+    }
+    return size;
+  }
+  allocator_type get_allocator() const {
+    return shards_[0].map.get_allocator();
+  }
+
+  bool insert(const key_type& key, const mapped_type& obj) {
+    Shard& shard = ShardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.map.insert(key, obj).second;
+  }
+  void insert_or_assign(const key_type& key, const mapped_type& obj) {
+    Shard& shard = ShardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.map.insert_or_assign(key, obj);
+  }
+  // Calls fn(value) under the shard lock, on a value-initialized one if
+  // the key was absent, as for a read-modify-write counter bump. fn must
+  // not call back into this map.
+  template <class Fn>
+  void update(const key_type& key, Fn fn) {
+    Shard& shard = ShardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    fn(shard.map[key]);
+  }
+  size_type erase(const key_type& key) {
+    Shard& shard = ShardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.map.erase(key);
+  }
+  void clear() {
+    for (Shard& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      shard.map.clear();
+    }
+  }
+
+  // Calls fn(map, index) for every shard, each under its lock, with the
+  // shards spread over ThreadPool::global(). fn must not call back into
+  // this map.
+  template <class Fn>
+  void for_each_shard(Fn fn) {
+    ThreadPool::global().parallel_for(Shards, [this, &fn](size_t i) {
+      std::lock_guard<std::mutex> lock(shards_[i].mutex);
+      fn(shards_[i].map, i);
+    });
+  }
+
+  static constexpr size_type shard_count() { return Shards; }
+  size_type shard_of(const key_type& key) const {
+    // Fibonacci hashing, so keys whose hash is the identity, like integers
+    // with a common stride, still spread over the shards.
+    const std::uint64_t h = static_cast<std::uint64_t>(hash_(key));
+    return static_cast<size_type>((h * 0x9E3779B97F4A7C15ull) >> 32) %
+           Shards;
+  }
+
+ private:
+  // One cache line or more per shard, so a lock taken on one shard does
+  // not invalidate its neighbours.
+  struct alignas(64) Shard {
+    explicit Shard(const Allocator& alloc) : map(alloc) {}
+
+    std::mutex mutex;
+    map_type map;
+  };
+
+  template <size_t... I>
+  ShardedMap(const Allocator& alloc, const Hash& hash,
+             std::index_sequence<I...>)
+      : hash_(hash), shards_{Shard(Pass<I>(alloc))...} {}
+  template <size_t>
+  static const Allocator& Pass(const Allocator& alloc) {
+    return alloc;
+  }
+
+  Shard& ShardOf(const key_type& key) const { return shards_[shard_of(key)]; }
+
+  Hash hash_;
+  // Map's lookups are non-const; every access holds the shard's lock.
+  mutable Shard shards_[Shards];
+};
+
+template class ShardedMap<int, int>;
+template class ShardedMap<double, double>;
+template class ShardedMap<char, char>;
+template class ShardedMap<float, float>;
+
+namespace pmr {
+template <typename K, typename V, size_t Shards = 16,
+          typename Hash = std::hash<K>>
+using ShardedMap = s21::ShardedMap<K, V, Shards, Hash,
+                                   PolymorphicAllocator<std::pair<const K, V>>>;
+}  // namespace pmr
+}  // namespace s21
+
+#endif  // SRC_SHARDED_MAP_H_
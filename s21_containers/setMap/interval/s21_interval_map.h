@@ -0,0 +1,155 @@
+#ifndef SRC_INTERVAL_MAP_H_
+#define SRC_INTERVAL_MAP_H_
+
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include "../../memory/memory_resource.h"
+#include "../iterators/s21_iterator.h"
+
+namespace s21 {
+// Half-open [lo, hi); ordered by lo, then hi.
+template <typename K>
+struct Interval {
+  K lo;
+  K hi;
+
+  bool overlaps(const K& from, const K& to) const {
+    return lo < to && from < hi;
+  }
+  bool operator==(const Interval& other) const {
+    return !(*this < other) && !(other < *this);
+  }
+  bool operator<(const Interval& other) const {
+    return lo < other.lo || (!(other.lo < lo) && hi < other.hi);
+  }
+};
+
+// Map from intervals to values answering "which intervals overlap
+// [lo, hi)". An AVLTree ordered by interval keeps, in every node, the
+// largest hi of its subtree; a query skips any subtree whose largest hi
+// is not past `lo` and stops at the first interval starting at or after
+// `hi`. Each interval reported costs at most one root-to-leaf walk, so a
+// query is O(log n) plus O(log n) per overlap at worst and close to
+// O(log n + k) when the intervals are short against the tree.
+//
+// K must have std::numeric_limits; equal intervals are one key.
+template <typename K, typename V,
+          typename Allocator = std::allocator<std::pair<const Interval<K>, V>>>
+class IntervalMap {
+ public:
+  using key_type = Interval<K>;
+  using mapped_type = V;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+ private:
+  using Entry = KeyOrdered<value_type>;
+  struct MaxEnd {
+    using result_type = K;
+    static K Identity() { return std::numeric_limits<K>::lowest(); }
+    static K Lift(const Entry& entry) { return entry.first.hi; }
+    static K Combine(const K& left, const K& right) {
+      return left < right ? right : left;
+    }
+  };
+  using tree_type = AVLTree<Entry, V,
+                            typename std::allocator_traits<Allocator>::
+                                template rebind_alloc<Entry>,
+                            MaxEnd>;
+  using node_type = Node<Entry, V>;
+
+ public:
+  using iterator = Iterator<Entry, V>;
+  // Walks the intervals overlapping one query in key order, finding each
+  // on demand.
+  class OverlapIterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = IntervalMap::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = value_type*;
+    using reference = value_type&;
+
+    OverlapIterator() : node_(nullptr), lo_(), hi_() {}
+
+    reference operator*() const { return node_->key; }
+    pointer operator->() const { return &node_->key; }
+    OverlapIterator& operator++();
+    OverlapIterator operator++(int) {
+      OverlapIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    bool operator==(const OverlapIterator& other) const {
+      return node_ == other.node_;
+    }
+    bool operator!=(const OverlapIterator& other) const {
+      return node_ != other.node_;
+    }
+
+   private:
+    friend class IntervalMap;
+    OverlapIterator(node_type* node, const K& lo, const K& hi)
+        : node_(node), lo_(lo), hi_(hi) {}
+
+    // Leftmost overlapping node under `node`, or nullptr.
+    node_type* First(node_type* node) const;
+
+    node_type* node_;
+    K lo_;
+    K hi_;
+  };
+  using overlap_range = IteratorRange<OverlapIterator>;
+
+  IntervalMap();
+  explicit IntervalMap(const Allocator& alloc);
+  IntervalMap(std::initializer_list<value_type> const& items,
+              const Allocator& alloc = Allocator());
+  IntervalMap(const IntervalMap& other) = default;
+  IntervalMap(IntervalMap&& other) = default;
+  IntervalMap& operator=(IntervalMap&& other) = default;
+  ~IntervalMap() = default;
+
+  iterator begin();
+  iterator end();
+
+  bool empty() const;
+  size_type size() const;
+
+  void clear();
+  // Throws std::invalid_argument unless lo < hi. An equal interval
+  // already present keeps its value.
+  std::pair<iterator, bool> insert(const K& lo, const K& hi, const V& value);
+  std::pair<iterator, bool> insert(const value_type& value);
+  void erase(iterator pos);
+  size_type erase(const K& lo, const K& hi);
+
+  iterator find(const K& lo, const K& hi);
+  // Intervals overlapping [lo, hi), lazily in key order.
+  overlap_range overlapping(const K& lo, const K& hi);
+  // Whether any interval overlaps [lo, hi): the first step of overlapping.
+  bool overlaps(const K& lo, const K& hi);
+  allocator_type get_allocator() const;
+
+ private:
+  tree_type tree_;
+
+  iterator At(node_type* node);
+  node_type* Locate(const key_type& key);
+};
+
+namespace pmr {
+template <typename K, typename V>
+using IntervalMap = s21::IntervalMap<
+    K, V, PolymorphicAllocator<std::pair<const Interval<K>, V>>>;
+}  // namespace pmr
+}  // namespace s21
+
+#include "s21_interval_map.tpp"
+
+#endif  // SRC_INTERVAL_MAP_H_
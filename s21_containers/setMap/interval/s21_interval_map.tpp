@@ -0,0 +1,134 @@
+#include <stdexcept>
+
+#include "s21_interval_map.h"
+
+namespace s21 {
+template <typename K, typename V, typename A>
+IntervalMap<K, V, A>::IntervalMap() : IntervalMap(A()) {}
+template <typename K, typename V, typename A>
+IntervalMap<K, V, A>::IntervalMap(const A& alloc) : tree_(alloc) {}
+template <typename K, typename V, typename A>
+IntervalMap<K, V, A>::IntervalMap(
+    std::initializer_list<value_type> const& items, const A& alloc)
+    : IntervalMap(alloc) {
+  for (const auto& item : items) insert(item);
+}
+
+template <typename K, typename V, typename A>
+typename IntervalMap<K, V, A>::iterator IntervalMap<K, V, A>::begin() {
+  node_type* node = tree_.GetRoot();
+  while (node && node->left) node = node->left;
+  return At(node);
+}
+template <typename K, typename V, typename A>
+typename IntervalMap<K, V, A>::iterator IntervalMap<K, V, A>::end() {
+  return At(nullptr);
+}
+
+template <typename K, typename V, typename A>
+bool IntervalMap<K, V, A>::empty() const {
+  return tree_.GetRoot() == nullptr;
+}
+template <typename K, typename V, typename A>
+typename IntervalMap<K, V, A>::size_type IntervalMap<K, V, A>::size() const {
+  return tree_.GetRoot() ? tree_.GetRoot()->size_ : 0;
+}
+
+template <typename K, typename V, typename A>
+void IntervalMap<K, V, A>::clear() {
+  tree_.Clear(tree_.GetRoot());
+}
+template <typename K, typename V, typename A>
+std::pair<typename IntervalMap<K, V, A>::iterator, bool>
+IntervalMap<K, V, A>::insert(const K& lo, const K& hi, const V& value) {
+  return insert(value_type(key_type{lo, hi}, value));
+}
+template <typename K, typename V, typename A>
+std::pair<typename IntervalMap<K, V, A>::iterator, bool>
+IntervalMap<K, V, A>::insert(const value_type& value) {
+  if (!(value.first.lo < value.first.hi)) {
+    throw std::invalid_argument("Interval is empty");
+  }
+  node_type* node = tree_.Insert(Entry(value.first, value.second));
+  return std::make_pair(At(node), tree_.GetInserted());
+}
+template <typename K, typename V, typename A>
+void IntervalMap<K, V, A>::erase(iterator pos) {
+  if (pos != end()) tree_.Erase(pos.GetNode());
+}
+template <typename K, typename V, typename A>
+typename IntervalMap<K, V, A>::size_type IntervalMap<K, V, A>::erase(
+    const K& lo, const K& hi) {
+  node_type* node = Locate(key_type{lo, hi});
+  if (!node) return 0;
+  tree_.Erase(node);
+  return 1;
+}
+
+template <typename K, typename V, typename A>
+typename IntervalMap<K, V, A>::iterator IntervalMap<K, V, A>::find(
+    const K& lo, const K& hi) {
+  return At(Locate(key_type{lo, hi}));
+}
+template <typename K, typename V, typename A>
+typename IntervalMap<K, V, A>::overlap_range
+IntervalMap<K, V, A>::overlapping(const K& lo, const K& hi) {
+  OverlapIterator first(nullptr, lo, hi);
+  if (lo < hi) first.node_ = first.First(tree_.GetRoot());
+  return overlap_range(first, OverlapIterator(nullptr, lo, hi));
+}
+template <typename K, typename V, typename A>
+bool IntervalMap<K, V, A>::overlaps(const K& lo, const K& hi) {
+  return !overlapping(lo, hi).empty();
+}
+template <typename K, typename V, typename A>
+typename IntervalMap<K, V, A>::allocator_type
+IntervalMap<K, V, A>::get_allocator() const {
+  return allocator_type(tree_.GetAllocator());
+}
+
+template <typename K, typename V, typename A>
+typename IntervalMap<K, V, A>::iterator IntervalMap<K, V, A>::At(
+    node_type* node) {
+  return iterator(node, tree_.GetRoot());
+}
+template <typename K, typename V, typename A>
+typename IntervalMap<K, V, A>::node_type* IntervalMap<K, V, A>::Locate(
+    const key_type& key) {
+  node_type* node = tree_.PartitionPoint(
+      [&key](const Entry& entry) { return entry.first < key; });
+  return node && node->key.first == key ? node : nullptr;
+}
+
+template <typename K, typename V, typename A>
+typename IntervalMap<K, V, A>::OverlapIterator&
+IntervalMap<K, V, A>::OverlapIterator::operator++() {
+  node_type* node = node_;
+  node_ = First(node->right);
+  if (node_) return *this;
+  // Climb to the next key in order, trying the right subtree of every
+  // ancestor left behind; past an interval starting at hi_ nothing can
+  // overlap any more.
+  for (node_type* parent = node->parent; parent;
+       node = parent, parent = parent->parent) {
+    if (node != parent->left) continue;
+    if (!(parent->key.first.lo < hi_)) break;
+    if (lo_ < parent->key.first.hi) {
+      node_ = parent;
+      break;
+    }
+    node_ = First(parent->right);
+    if (node_) break;
+  }
+  return *this;
+}
+template <typename K, typename V, typename A>
+typename IntervalMap<K, V, A>::node_type*
+IntervalMap<K, V, A>::OverlapIterator::First(node_type* node) const {
+  if (!node || !(lo_ < tree_type::AggregateOf(node))) return nullptr;
+  if (node_type* found = First(node->left)) return found;
+  if (!(node->key.first.lo < hi_)) return nullptr;
+  if (lo_ < node->key.first.hi) return node;
+  return First(node->right);
+}
+}  // namespace s21
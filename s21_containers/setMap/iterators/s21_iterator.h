@@ -78,6 +78,8 @@ class Iterator {
     return node_->key;
   }
   pointer operator->() const { return &(node_->key); }
+  // The node under the iterator, nullptr at end().
+  Node<T, V>* GetNode() const { return node_; }
   int Size(Node<T, V>* node) {
     if (node) {
       return node->size_;
@@ -86,12 +88,9 @@ class Iterator {
   }
   Node<T, V>* MaximumKey(Node<T, V>* node) {
     if (node != nullptr) {
-      while (node->right != nullptr) {
-        return this->MaximumKey(node->right);
-      }
-      return node;
+      while (node->right != nullptr) node = node->right;
     }
-    return nullptr;
+    return node;
   }
   Iterator& OperatorHelper() {
     if (node_ != nullptr) {
@@ -129,6 +128,58 @@ class ConstIterator : public Iterator<const T, const V> {
   using typename Iterator<const T, const V>::pointer;
 };
 
+// Iterator over elements that may not be written in place: a Map that
+// folds its values into aggregates hands these out so that no write can
+// bypass the refresh.
+template <typename T, typename V>
+class ReadOnlyIterator : public Iterator<T, V> {
+ public:
+  using reference = const T&;
+  using pointer = const T*;
+
+  using Iterator<T, V>::Iterator;
+  ReadOnlyIterator(const Iterator<T, V>& other) : Iterator<T, V>(other) {}
+
+  reference operator*() const { return Iterator<T, V>::operator*(); }
+  pointer operator->() const { return Iterator<T, V>::operator->(); }
+  ReadOnlyIterator operator+(const size_t value) {
+    return Iterator<T, V>::operator+(value);
+  }
+  ReadOnlyIterator& operator++() {
+    Iterator<T, V>::operator++();
+    return *this;
+  }
+  ReadOnlyIterator operator++(int) {
+    ReadOnlyIterator tmp = *this;
+    ++*this;
+    return tmp;
+  }
+  ReadOnlyIterator& operator--() {
+    Iterator<T, V>::operator--();
+    return *this;
+  }
+  ReadOnlyIterator operator--(int) {
+    ReadOnlyIterator tmp = *this;
+    --*this;
+    return tmp;
+  }
+};
+
+// Two iterators that range-for can walk, as returned by range(lo, hi).
+template <typename It>
+class IteratorRange {
+ public:
+  IteratorRange(It first, It last) : first_(first), last_(last) {}
+
+  It begin() const { return first_; }
+  It end() const { return last_; }
+  bool empty() const { return first_ == last_; }
+
+ private:
+  It first_;
+  It last_;
+};
+
 }  // namespace s21
 
 #endif  // AVL_ITERATOR_H_
\ No newline at end of file
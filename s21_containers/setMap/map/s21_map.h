@@ -2,31 +2,73 @@
 #define AVL_MAP_H_
 
 #include <limits>
+#include <tuple>
+#include <type_traits>
 
+#include "../../memory/memory_resource.h"
+#include "../avlTree/s21_node_handle.h"
 #include "../iterators/s21_iterator.h"
 
 namespace s21 {
-template <typename T, typename V>
+// Aggregate, one of the s21::aggregate policies or a user's, is folded
+// over every subtree so that aggregate_range runs in O(log n). Mapped
+// values of such a Map change only through insert_or_assign and modify:
+// at(), operator[] and iterators give read-only access, since a write
+// through them could not refresh the aggregates above it. With a
+// transparent Compare such as std::less<>, lookups and erase(key) take any
+// type Compare orders against T, without building a T.
+template <typename T, typename V, typename Compare = std::less<T>,
+          typename Allocator = std::allocator<std::pair<const T, V>>,
+          typename Aggregate = aggregate::None>
 class Map {
  public:
   using key_type = T;
   using mapped_type = V;
   using default_value = mapped_type&;
   using value_type = std::pair<const key_type, mapped_type>;
-  using iterator = Iterator<value_type, V>;
+  using key_compare = Compare;
+  // Orders elements by key alone, so mapped values need not compare.
+  class value_compare {
+   public:
+    value_compare() = default;
+    explicit value_compare(const Compare& comp) : comp(comp) {}
+    bool operator()(const value_type& a, const value_type& b) const {
+      return comp(a.first, b.first);
+    }
+
+    Compare comp;
+  };
+  using tree_type =
+      AVLTree<value_type, V, Allocator, Aggregate, value_compare>;
+  using iterator =
+      std::conditional_t<tree_type::kAggregated,
+                         ReadOnlyIterator<value_type, V>,
+                         Iterator<value_type, V>>;
+  // What at() and operator[] return: const when values are aggregated.
+  using mapped_reference =
+      std::conditional_t<tree_type::kAggregated, const mapped_type&,
+                         mapped_type&>;
   using const_iterator = ConstIterator<value_type, V>;
+  using range_type = IteratorRange<iterator>;
   using size_type = size_t;
-  using Allocator = std::allocator<T>;
+  using allocator_type = Allocator;
+  // Nodes are allocated by the tree: stats::of<Map> reads its counters.
+  using stats_key = tree_type;
+  using node_type = NodeHandle<value_type, V, tree_type>;
+  using insert_return_type = InsertReturn<iterator, node_type>;
 
   Map();
-  Map(std::initializer_list<value_type> const& items);
+  explicit Map(const Allocator& alloc);
+  explicit Map(const Compare& comp, const Allocator& alloc = Allocator());
+  Map(std::initializer_list<value_type> const& items,
+      const Allocator& alloc = Allocator());
   Map(const Map& m);
   Map(Map&& m) = default;
-  Map<T, V> operator=(Map&& m);
+  Map& operator=(Map&& m);
   ~Map();
 
-  mapped_type& at(const T& key);
-  mapped_type& operator[](const T& key);
+  mapped_reference at(const T& key);
+  mapped_reference operator[](const T& key);
 
   iterator begin();
   iterator end();
@@ -41,20 +83,112 @@ class Map {
   std::pair<iterator, bool> insert(const key_type& key, const mapped_type& obj);
   std::pair<iterator, bool> insert_or_assign(const key_type& key,
                                              const mapped_type& obj);
+  // Calls fn(mapped_type&) on the value under `key`, then refreshes the
+  // aggregates above it, even if fn throws. Throws like at() when the key
+  // is absent.
+  template <typename Fn>
+  void modify(const key_type& key, Fn fn);
+  // Links the handle's node unless its key is present; the handle must
+  // come from a Map with an equal allocator.
+  insert_return_type insert(node_type&& node);
+  // Builds the element in place; it is freed again if its key is present.
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  // Builds the mapped value from `args` only when `key` is absent.
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args);
   void erase(iterator pos);
+  // Erases [first, last) and returns last: the range is cut out of the
+  // tree whole, so only freeing its elements grows with its length.
+  iterator erase(iterator first, iterator last);
+  size_type erase(const T& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type erase(const K& key);
+  // Erases the elements `pred` holds for in one pass that rebalances as
+  // it goes, instead of a descent per element; returns how many went.
+  // `pred` sees value_type&.
+  template <typename Pred>
+  size_type erase_if(Pred pred);
+  // Unlinks an element without freeing it, for insert(node_type&&).
+  node_type extract(iterator pos);
+  node_type extract(const T& key);
   void swap(Map& other);
   void merge(Map& other);
   bool contains(const T& key);
-  const AVLTree<value_type, V>& get_tree() const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key);
+  iterator find(const T& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key);
+  // Bounds and ranges compare keys only, as in std::map.
+  iterator lower_bound(const T& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K& key);
+  iterator upper_bound(const T& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K& key);
+  std::pair<iterator, iterator> equal_range(const T& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K& key);
+  // Elements with keys in [lo, hi) in order; empty unless lo < hi.
+  range_type range(const T& lo, const T& hi);
+  // Number of elements with keys in [lo, hi), in O(log n).
+  size_type count_range(const T& lo, const T& hi);
+  // Aggregate over the elements with keys in [lo, hi),
+  // Aggregate::Identity() when there are none.
+  auto aggregate_range(const T& lo, const T& hi);
+  key_compare key_comp() const;
+  value_compare value_comp() const;
+  const tree_type& get_tree() const;
+  allocator_type get_allocator() const;
+  stats::Counters alloc_stats() const;
+  // Height, node count and depth histogram of the underlying AVL tree;
+  // operation counters need -DS21_TREE_STATS.
+  TreeStats tree_stats() const;
 
  private:
-  AVLTree<value_type, V> tree_;
-  Allocator allocator;
+  tree_type tree_;
+
+  // Orders a key against stored elements, for try_emplace.
+  struct KeyLess {
+    bool operator()(const T& key, const value_type& x) const {
+      return comp(key, x.first);
+    }
+    bool operator()(const value_type& x, const T& key) const {
+      return comp(x.first, key);
+    }
 
-  mapped_type& operatorHelper(const T& key, int flag);
-  bool check_duplicates(const value_type& value);
+    Compare comp;
+  };
+
+  iterator At(Node<value_type, V>* node);
+  // Shared by the plain and transparent overloads: K is T or any type
+  // Compare accepts next to T.
+  template <typename K>
+  Node<value_type, V>* Locate(const K& key);
+  template <typename K>
+  Node<value_type, V>* LowerBound(const K& key);
+  template <typename K>
+  Node<value_type, V>* UpperBound(const K& key);
+  template <typename K>
+  std::pair<iterator, iterator> EqualRange(const K& key);
+  template <typename K>
+  size_type EraseKey(const K& key);
 };
 
+namespace pmr {
+template <typename T, typename V>
+using Map = s21::Map<T, V, std::less<T>,
+                     PolymorphicAllocator<std::pair<const T, V>>>;
+}  // namespace pmr
 }  // namespace s21
 
 #endif  // AVL_MAP_H_
\ No newline at end of file
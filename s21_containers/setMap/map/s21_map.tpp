@@ -1,74 +1,149 @@
+#ifndef AVL_MAP_TPP_
+#define AVL_MAP_TPP_
+
 #include "s21_map.h"
 namespace s21 {
-template <typename T, typename V>
-Map<T, V>::Map() : tree_() {}
-template <typename T, typename V>
-Map<T, V>::Map(
-    std::initializer_list<typename Map<T, V>::value_type> const& items) {
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+Map<T, V, Compare, Allocator, Aggregate>::Map() : tree_() {}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+Map<T, V, Compare, Allocator, Aggregate>::Map(const Allocator& alloc)
+    : tree_(alloc) {}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+Map<T, V, Compare, Allocator, Aggregate>::Map(const Compare& comp,
+                                              const Allocator& alloc)
+    : tree_(alloc, value_compare(comp)) {}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+Map<T, V, Compare, Allocator, Aggregate>::Map(
+    std::initializer_list<value_type> const& items, const Allocator& alloc)
+    : tree_(alloc) {
   for (auto i = items.begin(); i != items.end(); ++i) {
     this->insert(*i);
   }
 }
-template <typename T, typename V>
-Map<T, V>::Map(const Map& m) : tree_(m.get_tree()) {}
-template <typename T, typename V>
-Map<T, V> Map<T, V>::operator=(Map<T, V>&& m) {
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+Map<T, V, Compare, Allocator, Aggregate>::Map(const Map& m)
+    : tree_(m.get_tree()) {}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+Map<T, V, Compare, Allocator, Aggregate>&
+Map<T, V, Compare, Allocator, Aggregate>::operator=(Map&& m) {
   if (this != &m) {
     tree_ = std::move(m.tree_);
   }
   return *this;
 }
-template <typename T, typename V>
-Map<T, V>::~Map() {}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+Map<T, V, Compare, Allocator, Aggregate>::~Map() {}
 
-template <typename T, typename V>
-std::pair<typename Map<T, V>::iterator, bool> Map<T, V>::insert(
-    const value_type& value) {
-  std::pair<typename Map<T, V>::iterator, bool> result;
-  if (check_duplicates(value)) {
-    auto res = this->tree_.Search(value);
-    return std::make_pair(iterator(res), false);
-  }
-  this->tree_.Insert(value);
-  auto res = this->tree_.Search(value);
-  if (this->tree_.GetInserted()) {
-    result = std::make_pair(iterator(res), true);
-  } else {
-    result = std::make_pair(iterator(res), false);
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+std::pair<typename Map<T, V, Compare, Allocator, Aggregate>::iterator, bool>
+Map<T, V, Compare, Allocator, Aggregate>::insert(const value_type& value) {
+  Node<value_type, V>* node = tree_.Insert(value);
+  return std::make_pair(At(node), tree_.GetInserted());
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+std::pair<typename Map<T, V, Compare, Allocator, Aggregate>::iterator, bool>
+Map<T, V, Compare, Allocator, Aggregate>::insert(const key_type& key,
+                                                 const mapped_type& obj) {
+  return try_emplace(key, obj);
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+std::pair<typename Map<T, V, Compare, Allocator, Aggregate>::iterator, bool>
+Map<T, V, Compare, Allocator, Aggregate>::insert_or_assign(
+    const key_type& key, const mapped_type& obj) {
+  auto result = try_emplace(key, obj);
+  if (!result.second) {
+    result.first.GetNode()->key.second = obj;
+    tree_.Refresh(result.first.GetNode());
   }
   return result;
 }
-template <typename T, typename V>
-std::pair<typename Map<T, V>::iterator, bool> Map<T, V>::insert(
-    const key_type& key, const mapped_type& obj) {
-  return insert(std::pair<key_type, mapped_type>(key, obj));
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+typename Map<T, V, Compare, Allocator, Aggregate>::insert_return_type
+Map<T, V, Compare, Allocator, Aggregate>::insert(node_type&& node) {
+  if (node.empty()) return insert_return_type{end(), false, node_type()};
+  Node<value_type, V>* found = tree_.InsertNode(node.GetNode());
+  if (!tree_.GetInserted()) {
+    return insert_return_type{At(found), false, std::move(node)};
+  }
+  node.Release();
+  return insert_return_type{At(found), true, node_type()};
 }
-template <typename T, typename V>
-std::pair<typename Map<T, V>::iterator, bool> Map<T, V>::insert_or_assign(
-    const key_type& key, const mapped_type& obj) {
-  if (this->empty()) {
-    return insert(std::make_pair(key, obj));
-  } else {
-    iterator i = this->begin();
-    for (; i != this->end(); ++i) {
-      if (i->first == key) {
-        i->second = obj;
-        return std::make_pair(i, false);
-      }
-    }
-    return insert(std::make_pair(key, obj));
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+template <typename... Args>
+std::pair<typename Map<T, V, Compare, Allocator, Aggregate>::iterator, bool>
+Map<T, V, Compare, Allocator, Aggregate>::emplace(Args&&... args) {
+  Node<value_type, V>* node = tree_.Emplace(std::forward<Args>(args)...);
+  return std::make_pair(At(node), tree_.GetInserted());
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+template <typename... Args>
+std::pair<typename Map<T, V, Compare, Allocator, Aggregate>::iterator, bool>
+Map<T, V, Compare, Allocator, Aggregate>::try_emplace(const key_type& key,
+                                                      Args&&... args) {
+  Node<value_type, V>* node = tree_.EmplaceUnique(
+      key, KeyLess{key_comp()}, std::piecewise_construct,
+      std::forward_as_tuple(key),
+      std::forward_as_tuple(std::forward<Args>(args)...));
+  return std::make_pair(At(node), tree_.GetInserted());
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+template <typename... Args>
+std::pair<typename Map<T, V, Compare, Allocator, Aggregate>::iterator, bool>
+Map<T, V, Compare, Allocator, Aggregate>::try_emplace(key_type&& key,
+                                                      Args&&... args) {
+  // The key is only moved from once the descent has finished with it.
+  Node<value_type, V>* node = tree_.EmplaceUnique(
+      key, KeyLess{key_comp()}, std::piecewise_construct,
+      std::forward_as_tuple(std::move(key)),
+      std::forward_as_tuple(std::forward<Args>(args)...));
+  return std::make_pair(At(node), tree_.GetInserted());
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+template <typename Fn>
+void Map<T, V, Compare, Allocator, Aggregate>::modify(const key_type& key,
+                                                      Fn fn) {
+  Node<value_type, V>* node = Locate(key);
+  if (!node) throw std::invalid_argument("This key doesn't exist");
+  try {
+    fn(node->key.second);
+  } catch (...) {
+    tree_.Refresh(node);
+    throw;
   }
+  tree_.Refresh(node);
 }
-template <typename T, typename V>
-typename Map<T, V>::mapped_type& Map<T, V>::at(const T& key) {
-  return operatorHelper(key, 0);
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+typename Map<T, V, Compare, Allocator, Aggregate>::mapped_reference
+Map<T, V, Compare, Allocator, Aggregate>::at(const T& key) {
+  if (Node<value_type, V>* node = Locate(key)) return node->key.second;
+  throw std::invalid_argument("This key doesn't exist");
 }
-template <typename T, typename V>
-typename Map<T, V>::mapped_type& Map<T, V>::operator[](const T& key) {
-  return operatorHelper(key, 1);
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+typename Map<T, V, Compare, Allocator, Aggregate>::mapped_reference
+Map<T, V, Compare, Allocator, Aggregate>::operator[](const T& key) {
+  return try_emplace(key).first->second;
 }
-template <typename T, typename V>
-typename Map<T, V>::iterator Map<T, V>::begin() {
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+typename Map<T, V, Compare, Allocator, Aggregate>::iterator
+Map<T, V, Compare, Allocator, Aggregate>::begin() {
   Node<value_type, V>* node = tree_.GetRoot();
   if (node == nullptr) {
     return iterator(nullptr);
@@ -82,12 +157,15 @@ typename Map<T, V>::iterator Map<T, V>::begin() {
     return iterator(node);
   }
 }
-template <typename T, typename V>
-typename Map<T, V>::iterator Map<T, V>::end() {
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+typename Map<T, V, Compare, Allocator, Aggregate>::iterator
+Map<T, V, Compare, Allocator, Aggregate>::end() {
   return iterator(nullptr, tree_.GetRoot());
 }
-template <typename T, typename V>
-bool Map<T, V>::empty() {
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+bool Map<T, V, Compare, Allocator, Aggregate>::empty() {
   if (this->tree_.GetRoot() == nullptr) {
     return true;
   }
@@ -96,84 +174,274 @@ bool Map<T, V>::empty() {
   }
   return false;
 }
-template <typename T, typename V>
-typename Map<T, V>::size_type Map<T, V>::size() {
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+typename Map<T, V, Compare, Allocator, Aggregate>::size_type
+Map<T, V, Compare, Allocator, Aggregate>::size() {
   if (this->tree_.GetRoot() == nullptr) {
     return 0;
   }
   return tree_.GetRoot()->size_;
 }
-template <typename T, typename V>
-typename Map<T, V>::size_type Map<T, V>::max_size() {
-  return allocator.max_size() / 10;
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+typename Map<T, V, Compare, Allocator, Aggregate>::size_type
+Map<T, V, Compare, Allocator, Aggregate>::max_size() {
+  return tree_.MaxSize();
 }
-template <typename T, typename V>
-void Map<T, V>::clear() {
-  if (this->get_tree().GetRoot()) {
-    for (iterator i = this->begin(); i != this->end(); i++) {
-      this->erase(i);
-    }
-  }
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+void Map<T, V, Compare, Allocator, Aggregate>::clear() {
+  tree_.Clear(tree_.GetRoot());
 }
-template <typename T, typename V>
-void Map<T, V>::erase(typename Map<T, V>::iterator pos) {
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+void Map<T, V, Compare, Allocator, Aggregate>::erase(iterator pos) {
   if (pos != nullptr) {
-    this->tree_.Remove(*pos);
+    tree_.Erase(pos.GetNode());
   }
 }
-template <typename T, typename V>
-void Map<T, V>::swap(Map& other) {
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+typename Map<T, V, Compare, Allocator, Aggregate>::iterator
+Map<T, V, Compare, Allocator, Aggregate>::erase(iterator first,
+                                                iterator last) {
+  tree_.EraseRange(first.GetNode(), last.GetNode());
+  return At(last.GetNode());
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+typename Map<T, V, Compare, Allocator, Aggregate>::size_type
+Map<T, V, Compare, Allocator, Aggregate>::erase(const T& key) {
+  return EraseKey(key);
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+template <typename K, typename C, typename>
+typename Map<T, V, Compare, Allocator, Aggregate>::size_type
+Map<T, V, Compare, Allocator, Aggregate>::erase(const K& key) {
+  return EraseKey(key);
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+template <typename Pred>
+typename Map<T, V, Compare, Allocator, Aggregate>::size_type
+Map<T, V, Compare, Allocator, Aggregate>::erase_if(Pred pred) {
+  return tree_.EraseIf(pred);
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+typename Map<T, V, Compare, Allocator, Aggregate>::node_type
+Map<T, V, Compare, Allocator, Aggregate>::extract(iterator pos) {
+  if (pos == end()) return node_type();
+  return node_type(tree_.Extract(pos.GetNode()), get_allocator());
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+typename Map<T, V, Compare, Allocator, Aggregate>::node_type
+Map<T, V, Compare, Allocator, Aggregate>::extract(const T& key) {
+  Node<value_type, V>* node = Locate(key);
+  if (!node) return node_type();
+  return node_type(tree_.Extract(node), get_allocator());
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+void Map<T, V, Compare, Allocator, Aggregate>::swap(Map& other) {
   tree_.Swap(other.tree_);
 }
-template <typename T, typename V>
-void Map<T, V>::merge(Map& other) {
-  std::pair<typename Map<T, V>::iterator, bool> result;
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+void Map<T, V, Compare, Allocator, Aggregate>::merge(Map& other) {
+  std::pair<iterator, bool> result;
   iterator iter = other.begin();
   while (iter != other.end()) {
+    iterator next = iter;
+    ++next;  // erase frees the node iter points to
     result = this->insert(*iter);
     if (result.second) other.erase(iter);
-    iter++;
+    iter = next;
   }
 }
-template <typename T, typename V>
-bool Map<T, V>::contains(const T& key) {
-  for (iterator i = this->begin(); i != this->end(); i++) {
-    if (i->first == key) return true;
-  }
-  return false;
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+bool Map<T, V, Compare, Allocator, Aggregate>::contains(const T& key) {
+  return Locate(key) != nullptr;
 }
-template <typename T, typename V>
-typename Map<T, V>::mapped_type& Map<T, V>::operatorHelper(const T& key,
-                                                           int flag) {
-  iterator i = this->begin();
-  if (i != nullptr) {
-    for (; i != this->end(); i++) {
-      if (i->first == key) {
-        return i->second;
-      }
-    }
-    if (flag) {
-      auto res = insert(value_type(key, mapped_type()));
-      return res.first->second;
-    } else {
-      throw std::invalid_argument("This key doesn't exist");
-    }
-  }
-  static mapped_type default_value;
-  return default_value;
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+template <typename K, typename C, typename>
+bool Map<T, V, Compare, Allocator, Aggregate>::contains(const K& key) {
+  return Locate(key) != nullptr;
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+typename Map<T, V, Compare, Allocator, Aggregate>::iterator
+Map<T, V, Compare, Allocator, Aggregate>::find(const T& key) {
+  return At(Locate(key));
 }
-template <typename T, typename V>
-const AVLTree<typename Map<T, V>::value_type, V>& Map<T, V>::get_tree() const {
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+template <typename K, typename C, typename>
+typename Map<T, V, Compare, Allocator, Aggregate>::iterator
+Map<T, V, Compare, Allocator, Aggregate>::find(const K& key) {
+  return At(Locate(key));
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+typename Map<T, V, Compare, Allocator, Aggregate>::iterator
+Map<T, V, Compare, Allocator, Aggregate>::lower_bound(const T& key) {
+  return At(LowerBound(key));
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+template <typename K, typename C, typename>
+typename Map<T, V, Compare, Allocator, Aggregate>::iterator
+Map<T, V, Compare, Allocator, Aggregate>::lower_bound(const K& key) {
+  return At(LowerBound(key));
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+typename Map<T, V, Compare, Allocator, Aggregate>::iterator
+Map<T, V, Compare, Allocator, Aggregate>::upper_bound(const T& key) {
+  return At(UpperBound(key));
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+template <typename K, typename C, typename>
+typename Map<T, V, Compare, Allocator, Aggregate>::iterator
+Map<T, V, Compare, Allocator, Aggregate>::upper_bound(const K& key) {
+  return At(UpperBound(key));
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+std::pair<typename Map<T, V, Compare, Allocator, Aggregate>::iterator,
+          typename Map<T, V, Compare, Allocator, Aggregate>::iterator>
+Map<T, V, Compare, Allocator, Aggregate>::equal_range(const T& key) {
+  return EqualRange(key);
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+template <typename K, typename C, typename>
+std::pair<typename Map<T, V, Compare, Allocator, Aggregate>::iterator,
+          typename Map<T, V, Compare, Allocator, Aggregate>::iterator>
+Map<T, V, Compare, Allocator, Aggregate>::equal_range(const K& key) {
+  return EqualRange(key);
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+typename Map<T, V, Compare, Allocator, Aggregate>::range_type
+Map<T, V, Compare, Allocator, Aggregate>::range(const T& lo, const T& hi) {
+  if (!key_comp()(lo, hi)) return range_type(end(), end());
+  return range_type(lower_bound(lo), lower_bound(hi));
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+typename Map<T, V, Compare, Allocator, Aggregate>::size_type
+Map<T, V, Compare, Allocator, Aggregate>::count_range(const T& lo,
+                                                      const T& hi) {
+  const Compare comp = key_comp();
+  if (!comp(lo, hi)) return 0;
+  return tree_.CountBefore(
+             [&](const value_type& x) { return comp(x.first, hi); }) -
+         tree_.CountBefore(
+             [&](const value_type& x) { return comp(x.first, lo); });
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+auto Map<T, V, Compare, Allocator, Aggregate>::aggregate_range(const T& lo,
+                                                               const T& hi) {
+  const Compare comp = key_comp();
+  if (!comp(lo, hi)) return Aggregate::Identity();
+  return tree_.Fold([&](const value_type& x) { return comp(x.first, lo); },
+                    [&](const value_type& x) { return comp(x.first, hi); });
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+typename Map<T, V, Compare, Allocator, Aggregate>::key_compare
+Map<T, V, Compare, Allocator, Aggregate>::key_comp() const {
+  return tree_.GetCompare().comp;
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+typename Map<T, V, Compare, Allocator, Aggregate>::value_compare
+Map<T, V, Compare, Allocator, Aggregate>::value_comp() const {
+  return tree_.GetCompare();
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+typename Map<T, V, Compare, Allocator, Aggregate>::iterator
+Map<T, V, Compare, Allocator, Aggregate>::At(Node<value_type, V>* node) {
+  return iterator(node, tree_.GetRoot());
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+const typename Map<T, V, Compare, Allocator, Aggregate>::tree_type&
+Map<T, V, Compare, Allocator, Aggregate>::get_tree() const {
   return tree_;
 }
-template <typename T, typename V>
-bool Map<T, V>::check_duplicates(const value_type& value) {
-  auto i = this->begin();
-  for (; i != this->end(); i++) {
-    if (i->first == value.first) {
-      return true;
-    }
-  }
-  return false;
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+typename Map<T, V, Compare, Allocator, Aggregate>::allocator_type
+Map<T, V, Compare, Allocator, Aggregate>::get_allocator() const {
+  return tree_.GetAllocator();
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+stats::Counters Map<T, V, Compare, Allocator, Aggregate>::alloc_stats() const {
+  return tree_.alloc_stats();
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+TreeStats Map<T, V, Compare, Allocator, Aggregate>::tree_stats() const {
+  return tree_.Stats();
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+template <typename K>
+Node<typename Map<T, V, Compare, Allocator, Aggregate>::value_type, V>*
+Map<T, V, Compare, Allocator, Aggregate>::Locate(const K& key) {
+  Node<value_type, V>* node = LowerBound(key);
+  return node && !key_comp()(key, node->key.first) ? node : nullptr;
 }
-}  // namespace s21
\ No newline at end of file
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+template <typename K>
+Node<typename Map<T, V, Compare, Allocator, Aggregate>::value_type, V>*
+Map<T, V, Compare, Allocator, Aggregate>::LowerBound(const K& key) {
+  const Compare comp = key_comp();
+  return tree_.PartitionPoint(
+      [&](const value_type& x) { return comp(x.first, key); });
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+template <typename K>
+Node<typename Map<T, V, Compare, Allocator, Aggregate>::value_type, V>*
+Map<T, V, Compare, Allocator, Aggregate>::UpperBound(const K& key) {
+  const Compare comp = key_comp();
+  return tree_.PartitionPoint(
+      [&](const value_type& x) { return !comp(key, x.first); });
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+template <typename K>
+std::pair<typename Map<T, V, Compare, Allocator, Aggregate>::iterator,
+          typename Map<T, V, Compare, Allocator, Aggregate>::iterator>
+Map<T, V, Compare, Allocator, Aggregate>::EqualRange(const K& key) {
+  iterator first = At(LowerBound(key));
+  iterator last = first;
+  if (first != end() && !key_comp()(key, first->first)) ++last;
+  return std::make_pair(first, last);
+}
+template <typename T, typename V, typename Compare, typename Allocator,
+          typename Aggregate>
+template <typename K>
+typename Map<T, V, Compare, Allocator, Aggregate>::size_type
+Map<T, V, Compare, Allocator, Aggregate>::EraseKey(const K& key) {
+  Node<value_type, V>* node = Locate(key);
+  if (!node) return 0;
+  tree_.Erase(node);
+  return 1;
+}
+}  // namespace s21
+
+#endif  // AVL_MAP_TPP_
@@ -0,0 +1,99 @@
+#ifndef AVL_MULTIMAP_H_
+#define AVL_MULTIMAP_H_
+
+#include "../../memory/memory_resource.h"
+#include "../../vector/vector.h"
+#include "../iterators/s21_iterator.h"
+
+namespace s21 {
+// Map that keeps every inserted element, equal keys included, each in a
+// node of its own: the values of one key sit next to each other in the
+// tree instead of in a container of their own. Elements compare by key
+// only, and those with equal keys iterate in insertion order.
+template <typename T, typename V,
+          typename Allocator = std::allocator<std::pair<const T, V>>>
+class Multimap {
+ public:
+  using key_type = T;
+  using mapped_type = V;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+ private:
+  using Entry = KeyOrdered<value_type>;
+
+ public:
+  // Tagged like Multiset's tree, so its stats are its own.
+  using tree_type = AVLTree<Entry, V,
+                            typename std::allocator_traits<Allocator>::
+                                template rebind_alloc<Entry>,
+                            aggregate::None, std::less<Entry>, Multimap>;
+  using iterator = Iterator<Entry, V>;
+  using range_type = IteratorRange<iterator>;
+  // Nodes are allocated by the tree: stats::of<Multimap> reads its
+  // counters.
+  using stats_key = tree_type;
+
+  Multimap();
+  explicit Multimap(const Allocator& alloc);
+  Multimap(std::initializer_list<value_type> const& items,
+           const Allocator& alloc = Allocator());
+  Multimap(const Multimap& m);
+  Multimap(Multimap&& m) = default;
+  Multimap& operator=(Multimap&& m);
+  ~Multimap() {}
+
+  iterator begin();
+  iterator end();
+
+  bool empty();
+  size_type size();
+  size_type max_size();
+
+  void clear();
+  iterator insert(const value_type& value);
+  iterator insert(const key_type& key, const mapped_type& obj);
+  // Inserts every argument, each a value_type, in order; every bool is
+  // true.
+  template <typename... Args>
+  Vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+  // Erases exactly the element under `pos`.
+  void erase(iterator pos);
+  // Erases every element with key `key`; returns how many.
+  size_type erase(const T& key);
+  void swap(Multimap& other);
+  // Takes every element of `other`, after those with equal keys already
+  // here. Nodes are relinked when the allocators compare equal and copied
+  // otherwise; `other` ends up empty either way.
+  void merge(Multimap& other);
+
+  // Elements with key `key`, from subtree sizes in O(log n).
+  size_type count(const T& key);
+  bool contains(const T& key);
+  // The first element inserted with key `key`.
+  iterator find(const T& key);
+  iterator lower_bound(const T& key);
+  iterator upper_bound(const T& key);
+  std::pair<iterator, iterator> equal_range(const T& key);
+  // Elements with keys in [lo, hi) in order; empty unless lo < hi.
+  range_type range(const T& lo, const T& hi);
+  const tree_type& get_tree() const;
+  allocator_type get_allocator() const;
+  stats::Counters alloc_stats() const;
+  TreeStats tree_stats() const;
+
+ private:
+  tree_type tree_;
+
+  iterator At(Node<Entry, V>* node);
+};
+
+namespace pmr {
+template <typename T, typename V>
+using Multimap =
+    s21::Multimap<T, V, PolymorphicAllocator<std::pair<const T, V>>>;
+}  // namespace pmr
+}  // namespace s21
+
+#endif  // AVL_MULTIMAP_H_
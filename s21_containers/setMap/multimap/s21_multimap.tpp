@@ -0,0 +1,183 @@
+#ifndef AVL_MULTIMAP_TPP_
+#define AVL_MULTIMAP_TPP_
+
+#include "./s21_multimap.h"
+
+namespace s21 {
+template <typename T, typename V, typename Allocator>
+Multimap<T, V, Allocator>::Multimap() : tree_() {}
+template <typename T, typename V, typename Allocator>
+Multimap<T, V, Allocator>::Multimap(const Allocator& alloc) : tree_(alloc) {}
+template <typename T, typename V, typename Allocator>
+Multimap<T, V, Allocator>::Multimap(
+    std::initializer_list<value_type> const& items, const Allocator& alloc)
+    : tree_(alloc) {
+  for (const auto& item : items) insert(item);
+}
+template <typename T, typename V, typename Allocator>
+Multimap<T, V, Allocator>::Multimap(const Multimap& m)
+    : tree_(m.get_tree()) {}
+template <typename T, typename V, typename Allocator>
+Multimap<T, V, Allocator>& Multimap<T, V, Allocator>::operator=(
+    Multimap&& m) {
+  if (this != &m) {
+    tree_ = std::move(m.tree_);
+  }
+  return *this;
+}
+
+template <typename T, typename V, typename Allocator>
+typename Multimap<T, V, Allocator>::iterator
+Multimap<T, V, Allocator>::begin() {
+  Node<Entry, V>* node = tree_.GetRoot();
+  while (node && node->left) node = node->left;
+  return At(node);
+}
+template <typename T, typename V, typename Allocator>
+typename Multimap<T, V, Allocator>::iterator Multimap<T, V, Allocator>::end() {
+  return At(nullptr);
+}
+template <typename T, typename V, typename Allocator>
+bool Multimap<T, V, Allocator>::empty() {
+  return tree_.GetRoot() == nullptr;
+}
+template <typename T, typename V, typename Allocator>
+typename Multimap<T, V, Allocator>::size_type
+Multimap<T, V, Allocator>::size() {
+  return tree_.GetRoot() ? tree_.GetRoot()->size_ : 0;
+}
+template <typename T, typename V, typename Allocator>
+typename Multimap<T, V, Allocator>::size_type
+Multimap<T, V, Allocator>::max_size() {
+  return tree_.MaxSize();
+}
+
+template <typename T, typename V, typename Allocator>
+void Multimap<T, V, Allocator>::clear() {
+  tree_.Clear(tree_.GetRoot());
+}
+template <typename T, typename V, typename Allocator>
+typename Multimap<T, V, Allocator>::iterator Multimap<T, V, Allocator>::insert(
+    const value_type& value) {
+  return At(tree_.InsertMulti(Entry(value.first, value.second)));
+}
+template <typename T, typename V, typename Allocator>
+typename Multimap<T, V, Allocator>::iterator Multimap<T, V, Allocator>::insert(
+    const key_type& key, const mapped_type& obj) {
+  return At(tree_.InsertMulti(Entry(key, obj)));
+}
+template <typename T, typename V, typename Allocator>
+template <typename... Args>
+Vector<std::pair<typename Multimap<T, V, Allocator>::iterator, bool>>
+Multimap<T, V, Allocator>::insert_many(Args&&... args) {
+  Vector<std::pair<iterator, bool>> result;
+  result.reserve(sizeof...(args));
+  (result.push_back(std::make_pair(insert(std::forward<Args>(args)), true)),
+   ...);
+  return result;
+}
+template <typename T, typename V, typename Allocator>
+void Multimap<T, V, Allocator>::erase(iterator pos) {
+  if (pos != end()) tree_.Erase(pos.GetNode());
+}
+template <typename T, typename V, typename Allocator>
+typename Multimap<T, V, Allocator>::size_type Multimap<T, V, Allocator>::erase(
+    const T& key) {
+  size_type erased = 0;
+  for (auto [it, last] = equal_range(key); it != last; ++erased) {
+    erase(it++);
+  }
+  return erased;
+}
+template <typename T, typename V, typename Allocator>
+void Multimap<T, V, Allocator>::swap(Multimap& other) {
+  tree_.Swap(other.tree_);
+}
+template <typename T, typename V, typename Allocator>
+void Multimap<T, V, Allocator>::merge(Multimap& other) {
+  if (this == &other) return;
+  if (get_allocator() == other.get_allocator()) {
+    // Smallest first, so equal keys from `other` keep their order.
+    while (Node<Entry, V>* node = other.begin().GetNode()) {
+      node = other.tree_.Extract(node);
+      try {
+        tree_.InsertNodeMulti(node);
+      } catch (...) {
+        tree_type::DestroyDetached(other.tree_.GetAllocator(), node);
+        throw;
+      }
+    }
+    return;
+  }
+  for (const auto& item : other) insert(item);
+  other.clear();
+}
+
+template <typename T, typename V, typename Allocator>
+typename Multimap<T, V, Allocator>::size_type Multimap<T, V, Allocator>::count(
+    const T& key) {
+  return tree_.CountBefore(
+             [&key](const Entry& x) { return !(key < x.first); }) -
+         tree_.CountBefore([&key](const Entry& x) { return x.first < key; });
+}
+template <typename T, typename V, typename Allocator>
+bool Multimap<T, V, Allocator>::contains(const T& key) {
+  return find(key) != end();
+}
+template <typename T, typename V, typename Allocator>
+typename Multimap<T, V, Allocator>::iterator Multimap<T, V, Allocator>::find(
+    const T& key) {
+  iterator first = lower_bound(key);
+  if (first != end() && !(key < first->first)) return first;
+  return end();
+}
+template <typename T, typename V, typename Allocator>
+typename Multimap<T, V, Allocator>::iterator
+Multimap<T, V, Allocator>::lower_bound(const T& key) {
+  return At(tree_.PartitionPoint(
+      [&key](const Entry& x) { return x.first < key; }));
+}
+template <typename T, typename V, typename Allocator>
+typename Multimap<T, V, Allocator>::iterator
+Multimap<T, V, Allocator>::upper_bound(const T& key) {
+  return At(tree_.PartitionPoint(
+      [&key](const Entry& x) { return !(key < x.first); }));
+}
+template <typename T, typename V, typename Allocator>
+std::pair<typename Multimap<T, V, Allocator>::iterator,
+          typename Multimap<T, V, Allocator>::iterator>
+Multimap<T, V, Allocator>::equal_range(const T& key) {
+  return std::make_pair(lower_bound(key), upper_bound(key));
+}
+template <typename T, typename V, typename Allocator>
+typename Multimap<T, V, Allocator>::range_type
+Multimap<T, V, Allocator>::range(const T& lo, const T& hi) {
+  if (!(lo < hi)) return range_type(end(), end());
+  return range_type(lower_bound(lo), lower_bound(hi));
+}
+template <typename T, typename V, typename Allocator>
+const typename Multimap<T, V, Allocator>::tree_type&
+Multimap<T, V, Allocator>::get_tree() const {
+  return tree_;
+}
+template <typename T, typename V, typename Allocator>
+typename Multimap<T, V, Allocator>::allocator_type
+Multimap<T, V, Allocator>::get_allocator() const {
+  return allocator_type(tree_.GetAllocator());
+}
+template <typename T, typename V, typename Allocator>
+stats::Counters Multimap<T, V, Allocator>::alloc_stats() const {
+  return tree_.alloc_stats();
+}
+template <typename T, typename V, typename Allocator>
+TreeStats Multimap<T, V, Allocator>::tree_stats() const {
+  return tree_.Stats();
+}
+template <typename T, typename V, typename Allocator>
+typename Multimap<T, V, Allocator>::iterator Multimap<T, V, Allocator>::At(
+    Node<Entry, V>* node) {
+  return iterator(node, tree_.GetRoot());
+}
+}  // namespace s21
+
+#endif  // AVL_MULTIMAP_TPP_
@@ -0,0 +1,88 @@
+#ifndef AVL_MULTISET_H_
+#define AVL_MULTISET_H_
+
+#include "../../memory/memory_resource.h"
+#include "../../vector/vector.h"
+#include "../iterators/s21_iterator.h"
+
+namespace s21 {
+// Set that keeps every inserted key, equal ones included, each in a node
+// of its own. Equal keys iterate in insertion order.
+template <typename T, typename Allocator = std::allocator<T>>
+class Multiset {
+ public:
+  using key_type = T;
+  using value_type = T;
+  using iterator = Iterator<T, T>;
+  using const_iterator = ConstIterator<T, T>;
+  using range_type = IteratorRange<iterator>;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+  // Tagged so that its stats stay apart from those of
+  // Set<T, std::less<T>, Allocator>, whose tree would otherwise be the
+  // same type.
+  using tree_type =
+      AVLTree<T, T, Allocator, aggregate::None, std::less<T>, Multiset>;
+  // Nodes are allocated by the tree: stats::of<Multiset> reads its
+  // counters.
+  using stats_key = tree_type;
+
+  Multiset();
+  explicit Multiset(const Allocator& alloc);
+  Multiset(std::initializer_list<value_type> const& items,
+           const Allocator& alloc = Allocator());
+  Multiset(const Multiset& s);
+  Multiset(Multiset&& s) = default;
+  Multiset& operator=(Multiset&& s);
+  ~Multiset() {}
+
+  iterator begin();
+  iterator end();
+
+  bool empty();
+  size_type size();
+  size_type max_size();
+
+  void clear();
+  iterator insert(const T& value);
+  // Inserts every argument in order; every bool is true.
+  template <typename... Args>
+  Vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+  // Erases exactly the key under `pos`.
+  void erase(iterator pos);
+  // Erases every key equal to `key`; returns how many.
+  size_type erase(const T& key);
+  void swap(Multiset& other);
+  // Takes every key of `other`, after the equal keys already here. Nodes
+  // are relinked when the allocators compare equal and copied otherwise;
+  // `other` ends up empty either way.
+  void merge(Multiset& other);
+
+  // Keys equal to `key`, from subtree sizes in O(log n).
+  size_type count(const T& key);
+  bool contains(const T& key);
+  // The first of the keys equal to `key`.
+  iterator find(const T& key);
+  iterator lower_bound(const T& key);
+  iterator upper_bound(const T& key);
+  std::pair<iterator, iterator> equal_range(const T& key);
+  // Keys in [lo, hi) in order; empty unless lo < hi.
+  range_type range(const T& lo, const T& hi);
+  const tree_type& get_tree() const;
+  allocator_type get_allocator() const;
+  stats::Counters alloc_stats() const;
+  TreeStats tree_stats() const;
+
+ private:
+  tree_type tree_;
+
+  iterator At(Node<T, T>* node);
+};
+
+namespace pmr {
+template <typename T>
+using Multiset = s21::Multiset<T, PolymorphicAllocator<T>>;
+}  // namespace pmr
+}  // namespace s21
+
+#endif  // AVL_MULTISET_H_
@@ -0,0 +1,171 @@
+#ifndef AVL_MULTISET_TPP_
+#define AVL_MULTISET_TPP_
+
+#include "./s21_multiset.h"
+
+namespace s21 {
+template <typename T, typename Allocator>
+Multiset<T, Allocator>::Multiset() : tree_() {}
+template <typename T, typename Allocator>
+Multiset<T, Allocator>::Multiset(const Allocator& alloc) : tree_(alloc) {}
+template <typename T, typename Allocator>
+Multiset<T, Allocator>::Multiset(
+    std::initializer_list<value_type> const& items, const Allocator& alloc)
+    : tree_(alloc) {
+  for (const auto& item : items) insert(item);
+}
+template <typename T, typename Allocator>
+Multiset<T, Allocator>::Multiset(const Multiset& s) : tree_(s.get_tree()) {}
+template <typename T, typename Allocator>
+Multiset<T, Allocator>& Multiset<T, Allocator>::operator=(Multiset&& s) {
+  if (this != &s) {
+    tree_ = std::move(s.tree_);
+  }
+  return *this;
+}
+
+template <typename T, typename Allocator>
+typename Multiset<T, Allocator>::iterator Multiset<T, Allocator>::begin() {
+  Node<T, T>* node = tree_.GetRoot();
+  while (node && node->left) node = node->left;
+  return At(node);
+}
+template <typename T, typename Allocator>
+typename Multiset<T, Allocator>::iterator Multiset<T, Allocator>::end() {
+  return At(nullptr);
+}
+template <typename T, typename Allocator>
+bool Multiset<T, Allocator>::empty() {
+  return tree_.GetRoot() == nullptr;
+}
+template <typename T, typename Allocator>
+typename Multiset<T, Allocator>::size_type Multiset<T, Allocator>::size() {
+  return tree_.GetRoot() ? tree_.GetRoot()->size_ : 0;
+}
+template <typename T, typename Allocator>
+typename Multiset<T, Allocator>::size_type
+Multiset<T, Allocator>::max_size() {
+  return tree_.MaxSize();
+}
+
+template <typename T, typename Allocator>
+void Multiset<T, Allocator>::clear() {
+  tree_.Clear(tree_.GetRoot());
+}
+template <typename T, typename Allocator>
+typename Multiset<T, Allocator>::iterator Multiset<T, Allocator>::insert(
+    const T& value) {
+  return At(tree_.InsertMulti(value));
+}
+template <typename T, typename Allocator>
+template <typename... Args>
+Vector<std::pair<typename Multiset<T, Allocator>::iterator, bool>>
+Multiset<T, Allocator>::insert_many(Args&&... args) {
+  Vector<std::pair<iterator, bool>> result;
+  result.reserve(sizeof...(args));
+  (result.push_back(std::make_pair(insert(std::forward<Args>(args)), true)),
+   ...);
+  return result;
+}
+template <typename T, typename Allocator>
+void Multiset<T, Allocator>::erase(iterator pos) {
+  if (pos != end()) tree_.Erase(pos.GetNode());
+}
+template <typename T, typename Allocator>
+typename Multiset<T, Allocator>::size_type Multiset<T, Allocator>::erase(
+    const T& key) {
+  size_type erased = 0;
+  for (auto [it, last] = equal_range(key); it != last; ++erased) {
+    erase(it++);
+  }
+  return erased;
+}
+template <typename T, typename Allocator>
+void Multiset<T, Allocator>::swap(Multiset& other) {
+  tree_.Swap(other.tree_);
+}
+template <typename T, typename Allocator>
+void Multiset<T, Allocator>::merge(Multiset& other) {
+  if (this == &other) return;
+  if (get_allocator() == other.get_allocator()) {
+    // Smallest first, so equal keys from `other` keep their order.
+    while (Node<T, T>* node = other.begin().GetNode()) {
+      node = other.tree_.Extract(node);
+      try {
+        tree_.InsertNodeMulti(node);
+      } catch (...) {
+        tree_type::DestroyDetached(other.tree_.GetAllocator(), node);
+        throw;
+      }
+    }
+    return;
+  }
+  for (const T& key : other) insert(key);
+  other.clear();
+}
+
+template <typename T, typename Allocator>
+typename Multiset<T, Allocator>::size_type Multiset<T, Allocator>::count(
+    const T& key) {
+  return tree_.CountBefore([&key](const T& x) { return !(key < x); }) -
+         tree_.CountBefore([&key](const T& x) { return x < key; });
+}
+template <typename T, typename Allocator>
+bool Multiset<T, Allocator>::contains(const T& key) {
+  return find(key) != end();
+}
+template <typename T, typename Allocator>
+typename Multiset<T, Allocator>::iterator Multiset<T, Allocator>::find(
+    const T& key) {
+  iterator first = lower_bound(key);
+  if (first != end() && !(key < *first)) return first;
+  return end();
+}
+template <typename T, typename Allocator>
+typename Multiset<T, Allocator>::iterator Multiset<T, Allocator>::lower_bound(
+    const T& key) {
+  return At(tree_.PartitionPoint([&key](const T& x) { return x < key; }));
+}
+template <typename T, typename Allocator>
+typename Multiset<T, Allocator>::iterator Multiset<T, Allocator>::upper_bound(
+    const T& key) {
+  return At(tree_.PartitionPoint([&key](const T& x) { return !(key < x); }));
+}
+template <typename T, typename Allocator>
+std::pair<typename Multiset<T, Allocator>::iterator,
+          typename Multiset<T, Allocator>::iterator>
+Multiset<T, Allocator>::equal_range(const T& key) {
+  return std::make_pair(lower_bound(key), upper_bound(key));
+}
+template <typename T, typename Allocator>
+typename Multiset<T, Allocator>::range_type Multiset<T, Allocator>::range(
+    const T& lo, const T& hi) {
+  if (!(lo < hi)) return range_type(end(), end());
+  return range_type(lower_bound(lo), lower_bound(hi));
+}
+template <typename T, typename Allocator>
+const typename Multiset<T, Allocator>::tree_type&
+Multiset<T, Allocator>::get_tree() const {
+  return tree_;
+}
+template <typename T, typename Allocator>
+typename Multiset<T, Allocator>::allocator_type
+Multiset<T, Allocator>::get_allocator() const {
+  return tree_.GetAllocator();
+}
+template <typename T, typename Allocator>
+stats::Counters Multiset<T, Allocator>::alloc_stats() const {
+  return tree_.alloc_stats();
+}
+template <typename T, typename Allocator>
+TreeStats Multiset<T, Allocator>::tree_stats() const {
+  return tree_.Stats();
+}
+template <typename T, typename Allocator>
+typename Multiset<T, Allocator>::iterator Multiset<T, Allocator>::At(
+    Node<T, T>* node) {
+  return iterator(node, tree_.GetRoot());
+}
+}  // namespace s21
+
+#endif  // AVL_MULTISET_TPP_
@@ -0,0 +1,109 @@
+#ifndef SRC_PERSISTENT_MAP_H_
+#define SRC_PERSISTENT_MAP_H_
+
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "../../memory/memory_resource.h"
+#include "s21_persistent_tree.h"
+
+namespace s21 {
+struct PersistentSelectFirst {
+  template <typename Pair>
+  const typename Pair::first_type& operator()(const Pair& value) const {
+    return value.first;
+  }
+};
+
+// Immutable map with the same versioning as PersistentSet: every update
+// returns a new version in O(log n), copies are O(1) and old versions stay
+// valid for their readers.
+template <typename K, typename V,
+          typename Allocator = std::allocator<std::pair<const K, V>>>
+class PersistentMap {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+ private:
+  using tree_type =
+      PersistentTree<K, value_type, PersistentSelectFirst, Allocator>;
+
+ public:
+  using const_iterator = typename tree_type::ConstIterator;
+  using iterator = const_iterator;
+
+  PersistentMap() : tree_() {}
+  explicit PersistentMap(const Allocator& alloc) : tree_(alloc) {}
+  PersistentMap(std::initializer_list<value_type> const& items,
+                const Allocator& alloc = Allocator())
+      : tree_(alloc) {
+    for (const auto& item : items) tree_ = tree_.Insert(item);
+  }
+
+  const mapped_type& at(const key_type& key) const {
+    auto node = tree_.Find(key);
+    if (!node) {
+      throw std::invalid_argument("This key doesn't exist");
+    }
+    return node->value.second;
+  }
+
+  const_iterator begin() const { return tree_.Begin(); }
+  const_iterator end() const { return tree_.End(); }
+
+  bool empty() const { return tree_.Size() == 0; }
+  size_type size() const { return tree_.Size(); }
+  size_type max_size() const { return tree_.MaxSize(); }
+
+  // insert keeps the mapped value of a present key, insert_or_assign
+  // replaces it; both return the updated version.
+  [[nodiscard]] PersistentMap insert(const value_type& value) const {
+    return PersistentMap(tree_.Insert(value));
+  }
+  [[nodiscard]] PersistentMap insert(const key_type& key,
+                                     const mapped_type& obj) const {
+    return insert(value_type(key, obj));
+  }
+  [[nodiscard]] PersistentMap insert_or_assign(const key_type& key,
+                                               const mapped_type& obj) const {
+    return PersistentMap(tree_.Assign(value_type(key, obj)));
+  }
+  [[nodiscard]] PersistentMap erase(const key_type& key) const {
+    return PersistentMap(tree_.Erase(key));
+  }
+
+  bool contains(const key_type& key) const {
+    return tree_.Find(key) != nullptr;
+  }
+  const_iterator find(const key_type& key) const { return tree_.Locate(key); }
+  int height() const { return tree_.Height(); }
+  // True when both versions are the same tree, e.g. after a no-op update.
+  bool shares_root(const PersistentMap& other) const {
+    return tree_.Root() == other.tree_.Root();
+  }
+  allocator_type get_allocator() const { return tree_.GetAllocator(); }
+
+ private:
+  explicit PersistentMap(tree_type&& tree) : tree_(std::move(tree)) {}
+
+  tree_type tree_;
+};
+
+template class PersistentMap<int, int>;
+template class PersistentMap<double, double>;
+template class PersistentMap<char, char>;
+template class PersistentMap<float, float>;
+
+namespace pmr {
+template <typename K, typename V>
+using PersistentMap =
+    s21::PersistentMap<K, V, PolymorphicAllocator<std::pair<const K, V>>>;
+}  // namespace pmr
+}  // namespace s21
+
+#endif  // SRC_PERSISTENT_MAP_H_
@@ -0,0 +1,84 @@
+#ifndef SRC_PERSISTENT_SET_H_
+#define SRC_PERSISTENT_SET_H_
+
+#include <initializer_list>
+
+#include "../../memory/memory_resource.h"
+#include "s21_persistent_tree.h"
+
+namespace s21 {
+struct PersistentIdentity {
+  template <typename T>
+  const T& operator()(const T& value) const {
+    return value;
+  }
+};
+
+// Immutable set: insert and erase return a new version in O(log n) that
+// shares every untouched node with this one. Copies are O(1), and versions
+// stay valid and readable from any thread for as long as they are held.
+template <typename T, typename Allocator = std::allocator<T>>
+class PersistentSet {
+  using tree_type = PersistentTree<T, T, PersistentIdentity, Allocator>;
+
+ public:
+  using key_type = T;
+  using value_type = T;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+  using const_iterator = typename tree_type::ConstIterator;
+  using iterator = const_iterator;
+
+  PersistentSet() : tree_() {}
+  explicit PersistentSet(const Allocator& alloc) : tree_(alloc) {}
+  PersistentSet(std::initializer_list<value_type> const& items,
+                const Allocator& alloc = Allocator())
+      : tree_(alloc) {
+    for (const auto& item : items) tree_ = tree_.Insert(item);
+  }
+
+  const_iterator begin() const { return tree_.Begin(); }
+  const_iterator end() const { return tree_.End(); }
+
+  bool empty() const { return tree_.Size() == 0; }
+  size_type size() const { return tree_.Size(); }
+  size_type max_size() const { return tree_.MaxSize(); }
+
+  // Return the updated version; an insert of a present key or an erase of
+  // a missing one returns a version sharing the whole tree.
+  [[nodiscard]] PersistentSet insert(const value_type& value) const {
+    return PersistentSet(tree_.Insert(value));
+  }
+  [[nodiscard]] PersistentSet erase(const key_type& key) const {
+    return PersistentSet(tree_.Erase(key));
+  }
+
+  bool contains(const key_type& key) const {
+    return tree_.Find(key) != nullptr;
+  }
+  const_iterator find(const key_type& key) const { return tree_.Locate(key); }
+  int height() const { return tree_.Height(); }
+  // True when both versions are the same tree, e.g. after a no-op update.
+  bool shares_root(const PersistentSet& other) const {
+    return tree_.Root() == other.tree_.Root();
+  }
+  allocator_type get_allocator() const { return tree_.GetAllocator(); }
+
+ private:
+  explicit PersistentSet(tree_type&& tree) : tree_(std::move(tree)) {}
+
+  tree_type tree_;
+};
+
+template class PersistentSet<int>;
+template class PersistentSet<double>;
+template class PersistentSet<char>;
+template class PersistentSet<float>;
+
+namespace pmr {
+template <typename T>
+using PersistentSet = s21::PersistentSet<T, PolymorphicAllocator<T>>;
+}  // namespace pmr
+}  // namespace s21
+
+#endif  // SRC_PERSISTENT_SET_H_
@@ -0,0 +1,171 @@
+#ifndef SRC_PERSISTENT_TREE_H_
+#define SRC_PERSISTENT_TREE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#include "../../vector/vector.h"
+
+namespace s21 {
+// Immutable AVL node shared between versions. Children are never changed
+// after construction; refs counts the parents and versions pointing at it.
+template <typename Value>
+struct PersistentNode {
+  Value value;
+  const PersistentNode* left;
+  const PersistentNode* right;
+  int height;
+  size_t size;
+  mutable std::atomic<size_t> refs;
+
+  PersistentNode(const Value& v, const PersistentNode* l,
+                 const PersistentNode* r)
+      : value(v),
+        left(l),
+        right(r),
+        height(1 + std::max(l ? l->height : 0, r ? r->height : 0)),
+        size(1 + (l ? l->size : 0) + (r ? r->size : 0)),
+        refs(1) {}
+};
+
+// Path-copying AVL tree behind PersistentSet and PersistentMap. Every
+// update builds new nodes along one root-to-leaf path and shares all other
+// subtrees with the version it started from, so it costs O(log n) time and
+// memory and never touches nodes other versions can see. Reference counts
+// are atomic: versions may be read and dropped from any thread.
+//
+// KeyOf extracts the Key from a Value; keys are ordered with operator<.
+template <typename Key, typename Value, typename KeyOf, typename Allocator>
+class PersistentTree {
+ public:
+  using Node = PersistentNode<Value>;
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Node>;
+  // Move assignment only copies nodes when the allocators neither propagate
+  // nor compare equal.
+  static constexpr bool kNothrowMove =
+      std::allocator_traits<node_allocator>::
+          propagate_on_container_move_assignment::value ||
+      std::allocator_traits<node_allocator>::is_always_equal::value;
+
+  // In-order traversal over an explicit stack of the nodes still to visit.
+  class ConstIterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Value*;
+    using reference = const Value&;
+
+    ConstIterator() = default;
+    explicit ConstIterator(const Node* root) { PushLeft(root); }
+
+    reference operator*() const { return Current()->value; }
+    pointer operator->() const { return &Current()->value; }
+    ConstIterator& operator++() {
+      const Node* node = Current();
+      path_.pop_back();
+      PushLeft(node->right);
+      return *this;
+    }
+    ConstIterator operator++(int) {
+      ConstIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    bool operator==(const ConstIterator& other) const {
+      return Current() == other.Current();
+    }
+    bool operator!=(const ConstIterator& other) const {
+      return !(*this == other);
+    }
+
+   private:
+    friend class PersistentTree;
+
+    const Node* Current() const {
+      return path_.empty() ? nullptr : path_[path_.size() - 1];
+    }
+    void PushLeft(const Node* node) {
+      for (; node; node = node->left) path_.push_back(node);
+    }
+
+    Vector<const Node*> path_;
+  };
+
+  explicit PersistentTree(const Allocator& alloc = Allocator());
+  PersistentTree(const PersistentTree& other);
+  PersistentTree(PersistentTree&& other) noexcept;
+  PersistentTree& operator=(const PersistentTree& other);
+  PersistentTree& operator=(PersistentTree&& other) noexcept(kNothrowMove);
+  ~PersistentTree();
+
+  // New versions; *this is left untouched.
+  PersistentTree Insert(const Value& value) const;
+  PersistentTree Assign(const Value& value) const;
+  PersistentTree Erase(const Key& key) const;
+
+  const Node* Find(const Key& key) const;
+  ConstIterator Begin() const { return ConstIterator(root_); }
+  ConstIterator End() const { return ConstIterator(); }
+  ConstIterator Locate(const Key& key) const;
+  size_t Size() const { return root_ ? root_->size : 0; }
+  int Height() const { return root_ ? root_->height : 0; }
+  const Node* Root() const { return root_; }
+  Allocator GetAllocator() const { return Allocator(alloc_); }
+  size_t MaxSize() const { return node_traits::max_size(alloc_); }
+
+ private:
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  // Owning handle on one reference, so partially built paths are released
+  // when an allocation or a Value copy throws.
+  class Ref {
+   public:
+    Ref(const PersistentTree* tree, const Node* node)
+        : tree_(tree), node_(node) {}
+    Ref(Ref&& other) noexcept
+        : tree_(other.tree_), node_(std::exchange(other.node_, nullptr)) {}
+    Ref(const Ref&) = delete;
+    Ref& operator=(const Ref&) = delete;
+    Ref& operator=(Ref&&) = delete;
+    ~Ref() { tree_->Release(node_); }
+
+    const Node* get() const { return node_; }
+    const Node* operator->() const { return node_; }
+    const Node* release() { return std::exchange(node_, nullptr); }
+
+   private:
+    const PersistentTree* tree_;
+    const Node* node_;
+  };
+
+  PersistentTree(const PersistentTree& base, const Node* root);
+
+  static const Key& KeyOfNode(const Node* node) {
+    return KeyOf()(node->value);
+  }
+  static int HeightOf(const Node* node) { return node ? node->height : 0; }
+
+  Ref Retain(const Node* node) const;
+  void Release(const Node* node) const;
+  Ref Make(const Value& value, Ref left, Ref right) const;
+  // A copy of the subtree built with this tree's allocator.
+  Ref Copy(const Node* node) const;
+  Ref Balance(const Value& value, Ref left, Ref right) const;
+  Ref Insert(const Node* node, const Value& value) const;
+  Ref Erase(const Node* node, const Key& key) const;
+  Ref RemoveMin(const Node* node) const;
+
+  const Node* root_;
+  mutable node_allocator alloc_;
+};
+}  // namespace s21
+
+#include "s21_persistent_tree.tpp"
+
+#endif  // SRC_PERSISTENT_TREE_H_
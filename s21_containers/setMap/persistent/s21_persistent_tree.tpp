@@ -0,0 +1,227 @@
+#include "s21_persistent_tree.h"
+
+namespace s21 {
+template <typename K, typename V, typename KeyOf, typename A>
+PersistentTree<K, V, KeyOf, A>::PersistentTree(const A& alloc)
+    : root_(nullptr), alloc_(alloc) {}
+template <typename K, typename V, typename KeyOf, typename A>
+PersistentTree<K, V, KeyOf, A>::PersistentTree(const PersistentTree& other)
+    : root_(other.Retain(other.root_).release()), alloc_(other.alloc_) {}
+template <typename K, typename V, typename KeyOf, typename A>
+PersistentTree<K, V, KeyOf, A>::PersistentTree(PersistentTree&& other) noexcept
+    : root_(std::exchange(other.root_, nullptr)), alloc_(other.alloc_) {}
+template <typename K, typename V, typename KeyOf, typename A>
+PersistentTree<K, V, KeyOf, A>::PersistentTree(const PersistentTree& base,
+                                               const Node* root)
+    : root_(root), alloc_(base.alloc_) {}
+template <typename K, typename V, typename KeyOf, typename A>
+PersistentTree<K, V, KeyOf, A>& PersistentTree<K, V, KeyOf, A>::operator=(
+    const PersistentTree& other) {
+  if (this != &other) {
+    if constexpr (node_traits::propagate_on_container_copy_assignment::value) {
+      Release(std::exchange(root_, nullptr));
+      alloc_ = other.alloc_;
+    }
+    // The last owner frees a node through its own allocator, so nodes are
+    // only shared between trees whose allocators compare equal; any other
+    // assignment copies them into ours.
+    Ref root =
+        alloc_ == other.alloc_ ? Retain(other.root_) : Copy(other.root_);
+    Release(std::exchange(root_, root.release()));
+  }
+  return *this;
+}
+template <typename K, typename V, typename KeyOf, typename A>
+PersistentTree<K, V, KeyOf, A>& PersistentTree<K, V, KeyOf, A>::operator=(
+    PersistentTree&& other) noexcept(kNothrowMove) {
+  if (this != &other) {
+    if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+      Release(std::exchange(root_, nullptr));
+      alloc_ = std::move(other.alloc_);
+    } else if (!(alloc_ == other.alloc_)) {
+      Ref root = Copy(other.root_);
+      Release(std::exchange(root_, root.release()));
+      other.Release(std::exchange(other.root_, nullptr));
+      return *this;
+    }
+    Release(std::exchange(root_, std::exchange(other.root_, nullptr)));
+  }
+  return *this;
+}
+template <typename K, typename V, typename KeyOf, typename A>
+PersistentTree<K, V, KeyOf, A>::~PersistentTree() {
+  Release(root_);
+}
+
+template <typename K, typename V, typename KeyOf, typename A>
+PersistentTree<K, V, KeyOf, A> PersistentTree<K, V, KeyOf, A>::Insert(
+    const V& value) const {
+  if (Find(KeyOf()(value))) return *this;
+  return PersistentTree(*this, Insert(root_, value).release());
+}
+template <typename K, typename V, typename KeyOf, typename A>
+PersistentTree<K, V, KeyOf, A> PersistentTree<K, V, KeyOf, A>::Assign(
+    const V& value) const {
+  return PersistentTree(*this, Insert(root_, value).release());
+}
+template <typename K, typename V, typename KeyOf, typename A>
+PersistentTree<K, V, KeyOf, A> PersistentTree<K, V, KeyOf, A>::Erase(
+    const K& key) const {
+  if (!Find(key)) return *this;
+  return PersistentTree(*this, Erase(root_, key).release());
+}
+
+template <typename K, typename V, typename KeyOf, typename A>
+const typename PersistentTree<K, V, KeyOf, A>::Node*
+PersistentTree<K, V, KeyOf, A>::Find(const K& key) const {
+  const Node* node = root_;
+  while (node) {
+    if (key < KeyOfNode(node)) {
+      node = node->left;
+    } else if (KeyOfNode(node) < key) {
+      node = node->right;
+    } else {
+      return node;
+    }
+  }
+  return nullptr;
+}
+template <typename K, typename V, typename KeyOf, typename A>
+typename PersistentTree<K, V, KeyOf, A>::ConstIterator
+PersistentTree<K, V, KeyOf, A>::Locate(const K& key) const {
+  // The path to the key holds exactly the ancestors an in-order walk from
+  // it still has to visit: those it descended left from.
+  ConstIterator it;
+  const Node* node = root_;
+  while (node) {
+    if (key < KeyOfNode(node)) {
+      it.path_.push_back(node);
+      node = node->left;
+    } else if (KeyOfNode(node) < key) {
+      node = node->right;
+    } else {
+      it.path_.push_back(node);
+      return it;
+    }
+  }
+  return End();
+}
+
+template <typename K, typename V, typename KeyOf, typename A>
+typename PersistentTree<K, V, KeyOf, A>::Ref
+PersistentTree<K, V, KeyOf, A>::Retain(const Node* node) const {
+  if (node) node->refs.fetch_add(1, std::memory_order_relaxed);
+  return Ref(this, node);
+}
+template <typename K, typename V, typename KeyOf, typename A>
+void PersistentTree<K, V, KeyOf, A>::Release(const Node* node) const {
+  // The last owner frees the node and drops its references on the children;
+  // acq_rel orders every other owner's reads before the destruction.
+  if (!node || node->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+    return;
+  }
+  const Node* left = node->left;
+  const Node* right = node->right;
+  Node* mutable_node = const_cast<Node*>(node);
+  node_traits::destroy(alloc_, mutable_node);
+  node_traits::deallocate(alloc_, mutable_node, 1);
+  Release(left);
+  Release(right);
+}
+template <typename K, typename V, typename KeyOf, typename A>
+typename PersistentTree<K, V, KeyOf, A>::Ref
+PersistentTree<K, V, KeyOf, A>::Make(const V& value, Ref left,
+                                     Ref right) const {
+  Node* node = node_traits::allocate(alloc_, 1);
+  try {
+    node_traits::construct(alloc_, node, value, left.get(), right.get());
+  } catch (...) {
+    node_traits::deallocate(alloc_, node, 1);
+    throw;
+  }
+  left.release();
+  right.release();
+  return Ref(this, node);
+}
+template <typename K, typename V, typename KeyOf, typename A>
+typename PersistentTree<K, V, KeyOf, A>::Ref
+PersistentTree<K, V, KeyOf, A>::Copy(const Node* node) const {
+  if (!node) return Ref(this, nullptr);
+  Ref left = Copy(node->left);
+  Ref right = Copy(node->right);
+  return Make(node->value, std::move(left), std::move(right));
+}
+template <typename K, typename V, typename KeyOf, typename A>
+typename PersistentTree<K, V, KeyOf, A>::Ref
+PersistentTree<K, V, KeyOf, A>::Balance(const V& value, Ref left,
+                                        Ref right) const {
+  // Children differ in height by at most two after one update; rotations
+  // rebuild the two or three nodes they move and share everything below.
+  int hl = HeightOf(left.get());
+  int hr = HeightOf(right.get());
+  if (hl > hr + 1) {
+    const Node* l = left.get();
+    if (HeightOf(l->left) >= HeightOf(l->right)) {
+      Ref inner = Make(value, Retain(l->right), std::move(right));
+      return Make(l->value, Retain(l->left), std::move(inner));
+    }
+    const Node* lr = l->right;
+    Ref new_left = Make(l->value, Retain(l->left), Retain(lr->left));
+    Ref new_right = Make(value, Retain(lr->right), std::move(right));
+    return Make(lr->value, std::move(new_left), std::move(new_right));
+  }
+  if (hr > hl + 1) {
+    const Node* r = right.get();
+    if (HeightOf(r->right) >= HeightOf(r->left)) {
+      Ref inner = Make(value, std::move(left), Retain(r->left));
+      return Make(r->value, std::move(inner), Retain(r->right));
+    }
+    const Node* rl = r->left;
+    Ref new_left = Make(value, std::move(left), Retain(rl->left));
+    Ref new_right = Make(r->value, Retain(rl->right), Retain(r->right));
+    return Make(rl->value, std::move(new_left), std::move(new_right));
+  }
+  return Make(value, std::move(left), std::move(right));
+}
+template <typename K, typename V, typename KeyOf, typename A>
+typename PersistentTree<K, V, KeyOf, A>::Ref
+PersistentTree<K, V, KeyOf, A>::Insert(const Node* node,
+                                       const V& value) const {
+  if (!node) return Make(value, Ref(this, nullptr), Ref(this, nullptr));
+  const K& key = KeyOf()(value);
+  if (key < KeyOfNode(node)) {
+    Ref left = Insert(node->left, value);
+    return Balance(node->value, std::move(left), Retain(node->right));
+  }
+  if (KeyOfNode(node) < key) {
+    Ref right = Insert(node->right, value);
+    return Balance(node->value, Retain(node->left), std::move(right));
+  }
+  return Make(value, Retain(node->left), Retain(node->right));
+}
+template <typename K, typename V, typename KeyOf, typename A>
+typename PersistentTree<K, V, KeyOf, A>::Ref
+PersistentTree<K, V, KeyOf, A>::Erase(const Node* node, const K& key) const {
+  if (key < KeyOfNode(node)) {
+    Ref left = Erase(node->left, key);
+    return Balance(node->value, std::move(left), Retain(node->right));
+  }
+  if (KeyOfNode(node) < key) {
+    Ref right = Erase(node->right, key);
+    return Balance(node->value, Retain(node->left), std::move(right));
+  }
+  if (!node->left) return Retain(node->right);
+  if (!node->right) return Retain(node->left);
+  const Node* min = node->right;
+  while (min->left) min = min->left;
+  Ref right = RemoveMin(node->right);
+  return Balance(min->value, Retain(node->left), std::move(right));
+}
+template <typename K, typename V, typename KeyOf, typename A>
+typename PersistentTree<K, V, KeyOf, A>::Ref
+PersistentTree<K, V, KeyOf, A>::RemoveMin(const Node* node) const {
+  if (!node->left) return Retain(node->right);
+  Ref left = RemoveMin(node->left);
+  return Balance(node->value, std::move(left), Retain(node->right));
+}
+}  // namespace s21
@@ -3,24 +3,44 @@
 
 #include <algorithm>
 
+#include "../../memory/memory_resource.h"
+#include "../avlTree/s21_node_handle.h"
 #include "../iterators/s21_iterator.h"
 
 namespace s21 {
 
-template <typename T>
+// Aggregate, one of the s21::aggregate policies or a user's, is folded
+// over every subtree so that aggregate_range runs in O(log n). With a
+// transparent Compare such as std::less<>, lookups and erase(key) take any
+// type Compare orders against T, without building a T.
+template <typename T, typename Compare = std::less<T>,
+          typename Allocator = std::allocator<T>,
+          typename Aggregate = aggregate::None>
 class Set {
  public:
+  using key_type = T;
   using value_type = T;
+  using key_compare = Compare;
+  using value_compare = Compare;
   using iterator = Iterator<T, T>;
   using const_iterator = ConstIterator<T, T>;
+  using range_type = IteratorRange<iterator>;
   using size_type = size_t;
-  using Allocator = std::allocator<T>;
+  using allocator_type = Allocator;
+  // Nodes are allocated by the tree: stats::of<Set> reads its counters.
+  using tree_type = AVLTree<T, T, Allocator, Aggregate, Compare>;
+  using stats_key = tree_type;
+  using node_type = NodeHandle<T, T, tree_type>;
+  using insert_return_type = InsertReturn<iterator, node_type>;
 
   Set();
-  Set(std::initializer_list<value_type> const& items);
+  explicit Set(const Allocator& alloc);
+  explicit Set(const Compare& comp, const Allocator& alloc = Allocator());
+  Set(std::initializer_list<value_type> const& items,
+      const Allocator& alloc = Allocator());
   Set(const Set& s);
-  Set(Set<T>&& s) = default;
-  Set<T>& operator=(Set&& s);
+  Set(Set&& s) = default;
+  Set& operator=(Set&& s);
   ~Set() {}
 
   iterator begin();
@@ -32,18 +52,90 @@ class Set {
 
   void clear();
   std::pair<iterator, bool> insert(const T& value);
+  // Links the handle's node unless its key is present; the handle must
+  // come from a Set with an equal allocator.
+  insert_return_type insert(node_type&& node);
+  // Builds the element in place; it is freed again if its key is present.
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
   void erase(iterator pos);
-  void swap(Set<T>& other);
-  void merge(Set<T>& other);
+  // Erases [first, last) and returns last: the range is cut out of the
+  // tree whole, so only freeing its elements grows with its length.
+  iterator erase(iterator first, iterator last);
+  size_type erase(const T& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type erase(const K& key);
+  // Erases the elements `pred` holds for in one pass that rebalances as
+  // it goes, instead of a descent per element; returns how many went.
+  template <typename Pred>
+  size_type erase_if(Pred pred);
+  // Unlinks an element without freeing it, for insert(node_type&&).
+  node_type extract(iterator pos);
+  node_type extract(const T& key);
+  void swap(Set& other);
+  void merge(Set& other);
 
   bool contains(const T& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key);
   iterator find(const T& key);
-  const AVLTree<T, T>& get_tree() const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key);
+  // First key not less than `key`, and first key greater than it.
+  iterator lower_bound(const T& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K& key);
+  iterator upper_bound(const T& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K& key);
+  std::pair<iterator, iterator> equal_range(const T& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K& key);
+  // Keys in [lo, hi) in order, found with one descent; empty unless
+  // lo < hi.
+  range_type range(const T& lo, const T& hi);
+  // Number of keys in [lo, hi), from subtree sizes in O(log n).
+  size_type count_range(const T& lo, const T& hi);
+  // Aggregate over the keys in [lo, hi), Aggregate::Identity() when there
+  // are none. Needs an Aggregate other than aggregate::None.
+  auto aggregate_range(const T& lo, const T& hi);
+  key_compare key_comp() const;
+  value_compare value_comp() const;
+  const tree_type& get_tree() const;
+  allocator_type get_allocator() const;
+  stats::Counters alloc_stats() const;
+  // Height, node count and depth histogram of the underlying AVL tree;
+  // operation counters need -DS21_TREE_STATS.
+  TreeStats tree_stats() const;
 
  private:
-  AVLTree<T, T> tree_;
-  Allocator allocator;
+  tree_type tree_;
+
+  iterator At(Node<T, T>* node);
+  // Shared by the plain and transparent overloads: K is T or any type
+  // Compare accepts next to T.
+  template <typename K>
+  Node<T, T>* Locate(const K& key);
+  template <typename K>
+  Node<T, T>* LowerBound(const K& key);
+  template <typename K>
+  Node<T, T>* UpperBound(const K& key);
+  template <typename K>
+  std::pair<iterator, iterator> EqualRange(const K& key);
+  template <typename K>
+  size_type EraseKey(const K& key);
 };
+
+namespace pmr {
+template <typename T>
+using Set = s21::Set<T, std::less<T>, PolymorphicAllocator<T>>;
+}  // namespace pmr
 }  // namespace s21
 
 #endif  // AVL_SET_H_
\ No newline at end of file
@@ -1,26 +1,41 @@
+#ifndef AVL_SET_TPP_
+#define AVL_SET_TPP_
+
 #include "./s21_set.h"
 
 namespace s21 {
-template <typename T>
-Set<T>::Set() : tree_() {}
-template <typename T>
-Set<T>::Set(std::initializer_list<value_type> const& items) : tree_() {
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+Set<T, Compare, Allocator, Aggregate>::Set() : tree_() {}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+Set<T, Compare, Allocator, Aggregate>::Set(const Allocator& alloc)
+    : tree_(alloc) {}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+Set<T, Compare, Allocator, Aggregate>::Set(const Compare& comp,
+                                           const Allocator& alloc)
+    : tree_(alloc, comp) {}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+Set<T, Compare, Allocator, Aggregate>::Set(
+    std::initializer_list<value_type> const& items, const Allocator& alloc)
+    : tree_(alloc) {
   for (auto i = items.begin(); i != items.end(); ++i) {
     this->insert(*i);
   }
 }
-template <typename T>
-Set<T>::Set(const Set& s) : tree_(s.get_tree()) {}
-template <typename T>
-Set<T>& Set<T>::operator=(Set<T>&& s) {
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+Set<T, Compare, Allocator, Aggregate>::Set(const Set& s)
+    : tree_(s.get_tree()) {}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+Set<T, Compare, Allocator, Aggregate>&
+Set<T, Compare, Allocator, Aggregate>::operator=(Set&& s) {
   if (this != &s) {
     tree_ = std::move(s.tree_);
   }
   return *this;
 }
 
-template <typename T>
-typename Set<T>::iterator Set<T>::begin() {
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+typename Set<T, Compare, Allocator, Aggregate>::iterator
+Set<T, Compare, Allocator, Aggregate>::begin() {
   Node<T, T>* node = tree_.GetRoot();
   if (node == nullptr) {
     return iterator(nullptr);
@@ -34,12 +49,13 @@ typename Set<T>::iterator Set<T>::begin() {
     return iterator(node);
   }
 }
-template <typename T>
-typename Set<T>::iterator Set<T>::end() {
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+typename Set<T, Compare, Allocator, Aggregate>::iterator
+Set<T, Compare, Allocator, Aggregate>::end() {
   return iterator(nullptr, tree_.GetRoot());
 }
-template <typename T>
-bool Set<T>::empty() {
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+bool Set<T, Compare, Allocator, Aggregate>::empty() {
   if (this->tree_.GetRoot() == nullptr) {
     return true;
   }
@@ -48,49 +64,100 @@ bool Set<T>::empty() {
   }
   return false;
 }
-template <typename T>
-typename Set<T>::size_type Set<T>::size() {
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+typename Set<T, Compare, Allocator, Aggregate>::size_type
+Set<T, Compare, Allocator, Aggregate>::size() {
   if (this->tree_.GetRoot() == nullptr) {
     return 0;
   }
   return tree_.GetRoot()->size_;
 }
-template <typename T>
-typename Set<T>::size_type Set<T>::max_size() {
-  return allocator.max_size() / 10;
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+typename Set<T, Compare, Allocator, Aggregate>::size_type
+Set<T, Compare, Allocator, Aggregate>::max_size() {
+  return tree_.MaxSize();
 }
-template <typename T>
-void Set<T>::clear() {
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+void Set<T, Compare, Allocator, Aggregate>::clear() {
   if (this->tree_.GetRoot()) {
     Node<T, T>* root = this->tree_.GetRoot();
     this->tree_.Clear(root);
     this->tree_.SetRoot(nullptr);
   }
 }
-template <typename T>
-std::pair<typename Set<T>::iterator, bool> Set<T>::insert(const T& value) {
-  std::pair<typename Set<T>::iterator, bool> result;
-  this->tree_.Insert(value);
-  if (this->tree_.GetInserted()) {
-    result = std::pair<typename Set<T>::iterator, bool>(find(value), true);
-  } else {
-    result = std::pair<typename Set<T>::iterator, bool>(find(value), false);
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+std::pair<typename Set<T, Compare, Allocator, Aggregate>::iterator, bool>
+Set<T, Compare, Allocator, Aggregate>::insert(const T& value) {
+  Node<T, T>* node = tree_.Insert(value);
+  return std::make_pair(At(node), tree_.GetInserted());
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+typename Set<T, Compare, Allocator, Aggregate>::insert_return_type
+Set<T, Compare, Allocator, Aggregate>::insert(node_type&& node) {
+  if (node.empty()) return insert_return_type{end(), false, node_type()};
+  Node<T, T>* found = tree_.InsertNode(node.GetNode());
+  if (!tree_.GetInserted()) {
+    return insert_return_type{At(found), false, std::move(node)};
   }
-  return result;
+  node.Release();
+  return insert_return_type{At(found), true, node_type()};
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+template <typename... Args>
+std::pair<typename Set<T, Compare, Allocator, Aggregate>::iterator, bool>
+Set<T, Compare, Allocator, Aggregate>::emplace(Args&&... args) {
+  Node<T, T>* node = tree_.Emplace(std::forward<Args>(args)...);
+  return std::make_pair(At(node), tree_.GetInserted());
 }
 
-template <typename T>
-void Set<T>::erase(Set<T>::iterator pos) {
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+void Set<T, Compare, Allocator, Aggregate>::erase(iterator pos) {
   if (pos != nullptr) {
-    tree_.Remove(*pos);
+    tree_.Erase(pos.GetNode());
   }
 }
-template <typename T>
-void Set<T>::swap(Set<T>& other) {
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+typename Set<T, Compare, Allocator, Aggregate>::iterator
+Set<T, Compare, Allocator, Aggregate>::erase(iterator first, iterator last) {
+  tree_.EraseRange(first.GetNode(), last.GetNode());
+  return At(last.GetNode());
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+typename Set<T, Compare, Allocator, Aggregate>::size_type
+Set<T, Compare, Allocator, Aggregate>::erase(const T& key) {
+  return EraseKey(key);
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+template <typename K, typename C, typename>
+typename Set<T, Compare, Allocator, Aggregate>::size_type
+Set<T, Compare, Allocator, Aggregate>::erase(const K& key) {
+  return EraseKey(key);
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+template <typename Pred>
+typename Set<T, Compare, Allocator, Aggregate>::size_type
+Set<T, Compare, Allocator, Aggregate>::erase_if(Pred pred) {
+  return tree_.EraseIf([&pred](const T& key) { return pred(key); });
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+typename Set<T, Compare, Allocator, Aggregate>::node_type
+Set<T, Compare, Allocator, Aggregate>::extract(iterator pos) {
+  if (pos == end()) return node_type();
+  return node_type(tree_.Extract(pos.GetNode()), get_allocator());
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+typename Set<T, Compare, Allocator, Aggregate>::node_type
+Set<T, Compare, Allocator, Aggregate>::extract(const T& key) {
+  Node<T, T>* node = Locate(key);
+  if (!node) return node_type();
+  return node_type(tree_.Extract(node), get_allocator());
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+void Set<T, Compare, Allocator, Aggregate>::swap(Set& other) {
   tree_.Swap(other.tree_);
 }
-template <typename T>
-void Set<T>::merge(Set<T>& other) {
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+void Set<T, Compare, Allocator, Aggregate>::merge(Set& other) {
   if (this != &other) {
     for (auto i = other.begin(); i != other.end(); i++) {
       insert(*i);
@@ -98,16 +165,152 @@ void Set<T>::merge(Set<T>& other) {
   }
   other.clear();
 }
-template <typename T>
-bool Set<T>::contains(const T& key) {
-  return tree_.Search(key) != nullptr;
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+bool Set<T, Compare, Allocator, Aggregate>::contains(const T& key) {
+  return Locate(key) != nullptr;
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+template <typename K, typename C, typename>
+bool Set<T, Compare, Allocator, Aggregate>::contains(const K& key) {
+  return Locate(key) != nullptr;
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+typename Set<T, Compare, Allocator, Aggregate>::iterator
+Set<T, Compare, Allocator, Aggregate>::find(const T& key) {
+  return At(Locate(key));
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+template <typename K, typename C, typename>
+typename Set<T, Compare, Allocator, Aggregate>::iterator
+Set<T, Compare, Allocator, Aggregate>::find(const K& key) {
+  return At(Locate(key));
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+typename Set<T, Compare, Allocator, Aggregate>::iterator
+Set<T, Compare, Allocator, Aggregate>::lower_bound(const T& key) {
+  return At(LowerBound(key));
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+template <typename K, typename C, typename>
+typename Set<T, Compare, Allocator, Aggregate>::iterator
+Set<T, Compare, Allocator, Aggregate>::lower_bound(const K& key) {
+  return At(LowerBound(key));
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+typename Set<T, Compare, Allocator, Aggregate>::iterator
+Set<T, Compare, Allocator, Aggregate>::upper_bound(const T& key) {
+  return At(UpperBound(key));
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+template <typename K, typename C, typename>
+typename Set<T, Compare, Allocator, Aggregate>::iterator
+Set<T, Compare, Allocator, Aggregate>::upper_bound(const K& key) {
+  return At(UpperBound(key));
 }
-template <typename T>
-typename Set<T>::iterator Set<T>::find(const T& key) {
-  return iterator(tree_.Search(key));
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+std::pair<typename Set<T, Compare, Allocator, Aggregate>::iterator,
+          typename Set<T, Compare, Allocator, Aggregate>::iterator>
+Set<T, Compare, Allocator, Aggregate>::equal_range(const T& key) {
+  return EqualRange(key);
 }
-template <typename T>
-const AVLTree<T, T>& Set<T>::get_tree() const {
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+template <typename K, typename C, typename>
+std::pair<typename Set<T, Compare, Allocator, Aggregate>::iterator,
+          typename Set<T, Compare, Allocator, Aggregate>::iterator>
+Set<T, Compare, Allocator, Aggregate>::equal_range(const K& key) {
+  return EqualRange(key);
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+typename Set<T, Compare, Allocator, Aggregate>::range_type
+Set<T, Compare, Allocator, Aggregate>::range(const T& lo, const T& hi) {
+  if (!key_comp()(lo, hi)) return range_type(end(), end());
+  return range_type(lower_bound(lo), lower_bound(hi));
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+typename Set<T, Compare, Allocator, Aggregate>::size_type
+Set<T, Compare, Allocator, Aggregate>::count_range(const T& lo, const T& hi) {
+  const Compare comp = key_comp();
+  if (!comp(lo, hi)) return 0;
+  return tree_.CountBefore([&](const T& x) { return comp(x, hi); }) -
+         tree_.CountBefore([&](const T& x) { return comp(x, lo); });
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+auto Set<T, Compare, Allocator, Aggregate>::aggregate_range(const T& lo,
+                                                            const T& hi) {
+  const Compare comp = key_comp();
+  if (!comp(lo, hi)) return Aggregate::Identity();
+  return tree_.Fold([&](const T& x) { return comp(x, lo); },
+                    [&](const T& x) { return comp(x, hi); });
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+Compare Set<T, Compare, Allocator, Aggregate>::key_comp() const {
+  return tree_.GetCompare();
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+Compare Set<T, Compare, Allocator, Aggregate>::value_comp() const {
+  return tree_.GetCompare();
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+const typename Set<T, Compare, Allocator, Aggregate>::tree_type&
+Set<T, Compare, Allocator, Aggregate>::get_tree() const {
   return tree_;
 }
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+typename Set<T, Compare, Allocator, Aggregate>::allocator_type
+Set<T, Compare, Allocator, Aggregate>::get_allocator() const {
+  return tree_.GetAllocator();
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+stats::Counters Set<T, Compare, Allocator, Aggregate>::alloc_stats() const {
+  return tree_.alloc_stats();
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+TreeStats Set<T, Compare, Allocator, Aggregate>::tree_stats() const {
+  return tree_.Stats();
+}
+// Carries the root so that --end() reaches the last key.
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+typename Set<T, Compare, Allocator, Aggregate>::iterator
+Set<T, Compare, Allocator, Aggregate>::At(Node<T, T>* node) {
+  return iterator(node, tree_.GetRoot());
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+template <typename K>
+Node<T, T>* Set<T, Compare, Allocator, Aggregate>::Locate(const K& key) {
+  Node<T, T>* node = LowerBound(key);
+  return node && !key_comp()(key, node->key) ? node : nullptr;
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+template <typename K>
+Node<T, T>* Set<T, Compare, Allocator, Aggregate>::LowerBound(const K& key) {
+  const Compare comp = key_comp();
+  return tree_.PartitionPoint([&](const T& x) { return comp(x, key); });
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+template <typename K>
+Node<T, T>* Set<T, Compare, Allocator, Aggregate>::UpperBound(const K& key) {
+  const Compare comp = key_comp();
+  return tree_.PartitionPoint([&](const T& x) { return !comp(key, x); });
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+template <typename K>
+std::pair<typename Set<T, Compare, Allocator, Aggregate>::iterator,
+          typename Set<T, Compare, Allocator, Aggregate>::iterator>
+Set<T, Compare, Allocator, Aggregate>::EqualRange(const K& key) {
+  iterator first = At(LowerBound(key));
+  iterator last = first;
+  if (first != end() && !key_comp()(key, *first)) ++last;
+  return std::make_pair(first, last);
+}
+template <typename T, typename Compare, typename Allocator, typename Aggregate>
+template <typename K>
+typename Set<T, Compare, Allocator, Aggregate>::size_type
+Set<T, Compare, Allocator, Aggregate>::EraseKey(const K& key) {
+  Node<T, T>* node = Locate(key);
+  if (!node) return 0;
+  tree_.Erase(node);
+  return 1;
+}
 }  // namespace s21
+
+#endif  // AVL_SET_TPP_
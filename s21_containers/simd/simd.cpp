@@ -0,0 +1,373 @@
+#include "simd.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define S21_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+static_assert(sizeof(int) == 4, "int kernels assume 32-bit lanes");
+
+namespace s21 {
+namespace simd {
+namespace {
+Level Detect() {
+#ifdef S21_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) return Level::kAvx2;
+  if (__builtin_cpu_supports("sse4.2")) return Level::kSse42;
+#endif
+  return Level::kScalar;
+}
+
+Level &Active() {
+  static Level level = detected_level();
+  return level;
+}
+
+#ifdef S21_SIMD_X86
+#define S21_AVX2 __attribute__((target("avx2")))
+#define S21_SSE42 __attribute__((target("sse4.2")))
+
+// Each kernel family is written once per instruction set. The helpers below
+// turn a lane comparison into a bit mask (one bit per 32-bit lane).
+
+S21_AVX2 inline unsigned MaskEq(__m256i a, __m256i b) {
+  return static_cast<unsigned>(
+      _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))));
+}
+S21_AVX2 inline unsigned MaskEq(__m256 a, __m256 b) {
+  return static_cast<unsigned>(
+      _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)));
+}
+S21_SSE42 inline unsigned MaskEq(__m128i a, __m128i b) {
+  return static_cast<unsigned>(
+      _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))));
+}
+S21_SSE42 inline unsigned MaskEq(__m128 a, __m128 b) {
+  return static_cast<unsigned>(_mm_movemask_ps(_mm_cmpeq_ps(a, b)));
+}
+
+// find
+
+S21_AVX2 const int *FindAvx2(const int *first, const int *last, int value) {
+  const __m256i needle = _mm256_set1_epi32(value);
+  for (; last - first >= 8; first += 8) {
+    __m256i block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first));
+    unsigned mask = MaskEq(block, needle);
+    if (mask) return first + __builtin_ctz(mask);
+  }
+  return scalar::find(first, last, value);
+}
+S21_AVX2 const float *FindAvx2(const float *first, const float *last,
+                               float value) {
+  const __m256 needle = _mm256_set1_ps(value);
+  for (; last - first >= 8; first += 8) {
+    unsigned mask = MaskEq(_mm256_loadu_ps(first), needle);
+    if (mask) return first + __builtin_ctz(mask);
+  }
+  return scalar::find(first, last, value);
+}
+S21_SSE42 const int *FindSse42(const int *first, const int *last, int value) {
+  const __m128i needle = _mm_set1_epi32(value);
+  for (; last - first >= 4; first += 4) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+    unsigned mask = MaskEq(block, needle);
+    if (mask) return first + __builtin_ctz(mask);
+  }
+  return scalar::find(first, last, value);
+}
+S21_SSE42 const float *FindSse42(const float *first, const float *last,
+                                 float value) {
+  const __m128 needle = _mm_set1_ps(value);
+  for (; last - first >= 4; first += 4) {
+    unsigned mask = MaskEq(_mm_loadu_ps(first), needle);
+    if (mask) return first + __builtin_ctz(mask);
+  }
+  return scalar::find(first, last, value);
+}
+
+// count
+
+S21_AVX2 std::size_t CountAvx2(const int *first, const int *last, int value) {
+  const __m256i needle = _mm256_set1_epi32(value);
+  std::size_t result = 0;
+  for (; last - first >= 8; first += 8) {
+    __m256i block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first));
+    result += __builtin_popcount(MaskEq(block, needle));
+  }
+  return result + scalar::count(first, last, value);
+}
+S21_AVX2 std::size_t CountAvx2(const float *first, const float *last,
+                               float value) {
+  const __m256 needle = _mm256_set1_ps(value);
+  std::size_t result = 0;
+  for (; last - first >= 8; first += 8) {
+    result += __builtin_popcount(MaskEq(_mm256_loadu_ps(first), needle));
+  }
+  return result + scalar::count(first, last, value);
+}
+S21_SSE42 std::size_t CountSse42(const int *first, const int *last,
+                                 int value) {
+  const __m128i needle = _mm_set1_epi32(value);
+  std::size_t result = 0;
+  for (; last - first >= 4; first += 4) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+    result += __builtin_popcount(MaskEq(block, needle));
+  }
+  return result + scalar::count(first, last, value);
+}
+S21_SSE42 std::size_t CountSse42(const float *first, const float *last,
+                                 float value) {
+  const __m128 needle = _mm_set1_ps(value);
+  std::size_t result = 0;
+  for (; last - first >= 4; first += 4) {
+    result += __builtin_popcount(MaskEq(_mm_loadu_ps(first), needle));
+  }
+  return result + scalar::count(first, last, value);
+}
+
+// min / max: reduce the extreme value, then locate its first occurrence.
+
+template <bool Max, class T>
+T Pick(T a, T b) {
+  return Max ? (a < b ? b : a) : (b < a ? b : a);
+}
+
+template <bool Max>
+S21_AVX2 int ExtremeAvx2(const int *first, const int *last) {
+  __m256i acc = _mm256_set1_epi32(*first);
+  const int *it = first;
+  for (; last - it >= 8; it += 8) {
+    __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(it));
+    acc = Max ? _mm256_max_epi32(acc, block) : _mm256_min_epi32(acc, block);
+  }
+  alignas(32) int lanes[8];
+  _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), acc);
+  int result = lanes[0];
+  for (int lane : lanes) result = Pick<Max>(result, lane);
+  for (; it != last; ++it) result = Pick<Max>(result, *it);
+  return result;
+}
+template <bool Max>
+S21_AVX2 float ExtremeAvx2(const float *first, const float *last) {
+  __m256 acc = _mm256_set1_ps(*first);
+  const float *it = first;
+  for (; last - it >= 8; it += 8) {
+    __m256 block = _mm256_loadu_ps(it);
+    acc = Max ? _mm256_max_ps(acc, block) : _mm256_min_ps(acc, block);
+  }
+  alignas(32) float lanes[8];
+  _mm256_store_ps(lanes, acc);
+  float result = lanes[0];
+  for (float lane : lanes) result = Pick<Max>(result, lane);
+  for (; it != last; ++it) result = Pick<Max>(result, *it);
+  return result;
+}
+template <bool Max>
+S21_SSE42 int ExtremeSse42(const int *first, const int *last) {
+  __m128i acc = _mm_set1_epi32(*first);
+  const int *it = first;
+  for (; last - it >= 4; it += 4) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(it));
+    acc = Max ? _mm_max_epi32(acc, block) : _mm_min_epi32(acc, block);
+  }
+  alignas(16) int lanes[4];
+  _mm_store_si128(reinterpret_cast<__m128i *>(lanes), acc);
+  int result = lanes[0];
+  for (int lane : lanes) result = Pick<Max>(result, lane);
+  for (; it != last; ++it) result = Pick<Max>(result, *it);
+  return result;
+}
+template <bool Max>
+S21_SSE42 float ExtremeSse42(const float *first, const float *last) {
+  __m128 acc = _mm_set1_ps(*first);
+  const float *it = first;
+  for (; last - it >= 4; it += 4) {
+    __m128 block = _mm_loadu_ps(it);
+    acc = Max ? _mm_max_ps(acc, block) : _mm_min_ps(acc, block);
+  }
+  alignas(16) float lanes[4];
+  _mm_store_ps(lanes, acc);
+  float result = lanes[0];
+  for (float lane : lanes) result = Pick<Max>(result, lane);
+  for (; it != last; ++it) result = Pick<Max>(result, *it);
+  return result;
+}
+
+// accumulate
+
+S21_AVX2 int AccumulateAvx2(const int *first, const int *last, int init) {
+  __m256i acc = _mm256_setzero_si256();
+  for (; last - first >= 8; first += 8) {
+    acc = _mm256_add_epi32(
+        acc, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first)));
+  }
+  alignas(32) int lanes[8];
+  _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), acc);
+  for (int lane : lanes) init += lane;
+  return scalar::accumulate(first, last, init);
+}
+S21_AVX2 float AccumulateAvx2(const float *first, const float *last,
+                              float init) {
+  __m256 acc = _mm256_setzero_ps();
+  for (; last - first >= 8; first += 8) {
+    acc = _mm256_add_ps(acc, _mm256_loadu_ps(first));
+  }
+  alignas(32) float lanes[8];
+  _mm256_store_ps(lanes, acc);
+  for (float lane : lanes) init += lane;
+  return scalar::accumulate(first, last, init);
+}
+S21_SSE42 int AccumulateSse42(const int *first, const int *last, int init) {
+  __m128i acc = _mm_setzero_si128();
+  for (; last - first >= 4; first += 4) {
+    acc = _mm_add_epi32(
+        acc, _mm_loadu_si128(reinterpret_cast<const __m128i *>(first)));
+  }
+  alignas(16) int lanes[4];
+  _mm_store_si128(reinterpret_cast<__m128i *>(lanes), acc);
+  for (int lane : lanes) init += lane;
+  return scalar::accumulate(first, last, init);
+}
+S21_SSE42 float AccumulateSse42(const float *first, const float *last,
+                                float init) {
+  __m128 acc = _mm_setzero_ps();
+  for (; last - first >= 4; first += 4) {
+    acc = _mm_add_ps(acc, _mm_loadu_ps(first));
+  }
+  alignas(16) float lanes[4];
+  _mm_store_ps(lanes, acc);
+  for (float lane : lanes) init += lane;
+  return scalar::accumulate(first, last, init);
+}
+
+// fill
+
+S21_AVX2 void FillAvx2(int *first, int *last, int value) {
+  const __m256i block = _mm256_set1_epi32(value);
+  for (; last - first >= 8; first += 8) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(first), block);
+  }
+  scalar::fill(first, last, value);
+}
+S21_AVX2 void FillAvx2(float *first, float *last, float value) {
+  const __m256 block = _mm256_set1_ps(value);
+  for (; last - first >= 8; first += 8) _mm256_storeu_ps(first, block);
+  scalar::fill(first, last, value);
+}
+S21_SSE42 void FillSse42(int *first, int *last, int value) {
+  const __m128i block = _mm_set1_epi32(value);
+  for (; last - first >= 4; first += 4) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(first), block);
+  }
+  scalar::fill(first, last, value);
+}
+S21_SSE42 void FillSse42(float *first, float *last, float value) {
+  const __m128 block = _mm_set1_ps(value);
+  for (; last - first >= 4; first += 4) _mm_storeu_ps(first, block);
+  scalar::fill(first, last, value);
+}
+#endif  // S21_SIMD_X86
+
+template <bool Max, class T>
+const T *Extreme(const T *first, const T *last) {
+  if (first == last) return last;
+#ifdef S21_SIMD_X86
+  T extreme{};
+  switch (Active()) {
+    case Level::kAvx2:
+      extreme = ExtremeAvx2<Max>(first, last);
+      // A NaN reduction matches no element; the scalar scan keeps std::'s
+      // answer.
+      if (extreme == extreme) return FindAvx2(first, last, extreme);
+      break;
+    case Level::kSse42:
+      extreme = ExtremeSse42<Max>(first, last);
+      if (extreme == extreme) return FindSse42(first, last, extreme);
+      break;
+    case Level::kScalar:
+      break;
+  }
+#endif
+  return Max ? scalar::max_element(first, last)
+             : scalar::min_element(first, last);
+}
+}  // namespace
+
+Level detected_level() {
+  static const Level level = Detect();
+  return level;
+}
+
+Level active_level() { return Active(); }
+
+void set_level(Level level) {
+  Active() = level < detected_level() ? level : detected_level();
+}
+
+#ifdef S21_SIMD_X86
+#define S21_SIMD_DISPATCH(kernel, ...)                     \
+  switch (Active()) {                                      \
+    case Level::kAvx2:                                     \
+      return kernel##Avx2(__VA_ARGS__);                    \
+    case Level::kSse42:                                    \
+      return kernel##Sse42(__VA_ARGS__);                   \
+    case Level::kScalar:                                   \
+      break;                                               \
+  }
+#else
+#define S21_SIMD_DISPATCH(kernel, ...)
+#endif
+
+const int *find(const int *first, const int *last, const int &value) {
+  S21_SIMD_DISPATCH(Find, first, last, value)
+  return scalar::find(first, last, value);
+}
+const float *find(const float *first, const float *last, const float &value) {
+  S21_SIMD_DISPATCH(Find, first, last, value)
+  return scalar::find(first, last, value);
+}
+
+std::size_t count(const int *first, const int *last, const int &value) {
+  S21_SIMD_DISPATCH(Count, first, last, value)
+  return scalar::count(first, last, value);
+}
+std::size_t count(const float *first, const float *last, const float &value) {
+  S21_SIMD_DISPATCH(Count, first, last, value)
+  return scalar::count(first, last, value);
+}
+
+const int *min_element(const int *first, const int *last) {
+  return Extreme<false>(first, last);
+}
+const float *min_element(const float *first, const float *last) {
+  return Extreme<false>(first, last);
+}
+const int *max_element(const int *first, const int *last) {
+  return Extreme<true>(first, last);
+}
+const float *max_element(const float *first, const float *last) {
+  return Extreme<true>(first, last);
+}
+
+int accumulate(const int *first, const int *last, int init) {
+  S21_SIMD_DISPATCH(Accumulate, first, last, init)
+  return scalar::accumulate(first, last, init);
+}
+float accumulate(const float *first, const float *last, float init) {
+  S21_SIMD_DISPATCH(Accumulate, first, last, init)
+  return scalar::accumulate(first, last, init);
+}
+
+void fill(int *first, int *last, const int &value) {
+  S21_SIMD_DISPATCH(Fill, first, last, value)
+  scalar::fill(first, last, value);
+}
+void fill(float *first, float *last, const float &value) {
+  S21_SIMD_DISPATCH(Fill, first, last, value)
+  scalar::fill(first, last, value);
+}
+}  // namespace simd
+}  // namespace s21
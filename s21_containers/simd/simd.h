@@ -0,0 +1,180 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+#include <cstddef>
+
+#include "../array/array.h"
+#include "../vector/vector.h"
+
+namespace s21 {
+namespace simd {
+/// Instruction sets the kernels can run on, in increasing order.
+enum class Level { kScalar, kSse42, kAvx2 };
+
+/// Best level supported by the CPU, detected once at first use.
+Level detected_level();
+/// Level the kernels currently dispatch to.
+Level active_level();
+/// Restricts dispatch to at most `level` (never above detected_level()).
+/// Meant for tests and benchmarks; not thread-safe against running kernels.
+void set_level(Level level);
+
+/// Plain loops, used for every element type without a vector kernel and as
+/// the reference the vector kernels are benchmarked against.
+namespace scalar {
+template <class T>
+const T *find(const T *first, const T *last, const T &value) {
+  for (; first != last; ++first) {
+    if (*first == value) break;
+  }
+  return first;
+}
+
+template <class T>
+std::size_t count(const T *first, const T *last, const T &value) {
+  std::size_t result = 0;
+  for (; first != last; ++first) {
+    if (*first == value) ++result;
+  }
+  return result;
+}
+
+template <class T>
+const T *min_element(const T *first, const T *last) {
+  const T *best = first;
+  for (; first != last; ++first) {
+    if (*first < *best) best = first;
+  }
+  return best;
+}
+
+template <class T>
+const T *max_element(const T *first, const T *last) {
+  const T *best = first;
+  for (; first != last; ++first) {
+    if (*best < *first) best = first;
+  }
+  return best;
+}
+
+template <class T>
+T accumulate(const T *first, const T *last, T init) {
+  for (; first != last; ++first) init = init + *first;
+  return init;
+}
+
+template <class T>
+void fill(T *first, T *last, const T &value) {
+  for (; first != last; ++first) *first = value;
+}
+}  // namespace scalar
+
+/// Generic versions fall back to the scalar loops.
+template <class T>
+const T *find(const T *first, const T *last, const T &value) {
+  return scalar::find(first, last, value);
+}
+template <class T>
+std::size_t count(const T *first, const T *last, const T &value) {
+  return scalar::count(first, last, value);
+}
+template <class T>
+const T *min_element(const T *first, const T *last) {
+  return scalar::min_element(first, last);
+}
+template <class T>
+const T *max_element(const T *first, const T *last) {
+  return scalar::max_element(first, last);
+}
+template <class T>
+T accumulate(const T *first, const T *last, T init) {
+  return scalar::accumulate(first, last, init);
+}
+template <class T>
+void fill(T *first, T *last, const T &value) {
+  scalar::fill(first, last, value);
+}
+
+/// Vectorized kernels for int and float, dispatched on active_level().
+/// min_element/max_element return the first extreme element like std::; with
+/// NaNs in a float range the result is unspecified but, for a non-empty
+/// range, always one of its elements. Float accumulate adds in lane order,
+/// so rounding may differ from the sequential sum.
+const int *find(const int *first, const int *last, const int &value);
+const float *find(const float *first, const float *last, const float &value);
+std::size_t count(const int *first, const int *last, const int &value);
+std::size_t count(const float *first, const float *last, const float &value);
+const int *min_element(const int *first, const int *last);
+const float *min_element(const float *first, const float *last);
+const int *max_element(const int *first, const int *last);
+const float *max_element(const float *first, const float *last);
+int accumulate(const int *first, const int *last, int init);
+float accumulate(const float *first, const float *last, float init);
+void fill(int *first, int *last, const int &value);
+void fill(float *first, float *last, const float &value);
+
+/// Container front-ends over Vector::data() and Array::data_ptr().
+template <class T, class A>
+typename Vector<T, A>::iterator find(Vector<T, A> &v, const T &value) {
+  const T *first = v.data();
+  return typename Vector<T, A>::iterator(
+      v.data() + (find(first, first + v.size(), value) - first));
+}
+template <class T, class A>
+std::size_t count(Vector<T, A> &v, const T &value) {
+  const T *first = v.data();
+  return count(first, first + v.size(), value);
+}
+template <class T, class A>
+typename Vector<T, A>::iterator min_element(Vector<T, A> &v) {
+  const T *first = v.data();
+  return typename Vector<T, A>::iterator(
+      v.data() + (min_element(first, first + v.size()) - first));
+}
+template <class T, class A>
+typename Vector<T, A>::iterator max_element(Vector<T, A> &v) {
+  const T *first = v.data();
+  return typename Vector<T, A>::iterator(
+      v.data() + (max_element(first, first + v.size()) - first));
+}
+template <class T, class A>
+T accumulate(Vector<T, A> &v, T init) {
+  const T *first = v.data();
+  return accumulate(first, first + v.size(), init);
+}
+template <class T, class A>
+void fill(Vector<T, A> &v, const T &value) {
+  fill(v.data(), v.data() + v.size(), value);
+}
+
+template <class T, std::size_t N, std::size_t Al>
+T *find(Array<T, N, Al> &a, const T &value) {
+  const T *first = a.data_ptr();
+  return a.data_ptr() + (find(first, first + N, value) - first);
+}
+template <class T, std::size_t N, std::size_t Al>
+std::size_t count(const Array<T, N, Al> &a, const T &value) {
+  return count(a.data_ptr(), a.data_ptr() + N, value);
+}
+template <class T, std::size_t N, std::size_t Al>
+T *min_element(Array<T, N, Al> &a) {
+  const T *first = a.data_ptr();
+  return a.data_ptr() + (min_element(first, first + N) - first);
+}
+template <class T, std::size_t N, std::size_t Al>
+T *max_element(Array<T, N, Al> &a) {
+  const T *first = a.data_ptr();
+  return a.data_ptr() + (max_element(first, first + N) - first);
+}
+template <class T, std::size_t N, std::size_t Al>
+T accumulate(const Array<T, N, Al> &a, T init) {
+  return accumulate(a.data_ptr(), a.data_ptr() + N, init);
+}
+template <class T, std::size_t N, std::size_t Al>
+void fill(Array<T, N, Al> &a, const T &value) {
+  fill(a.data_ptr(), a.data_ptr() + N, value);
+}
+}  // namespace simd
+}  // namespace s21
+
+#endif  // SIMD_H
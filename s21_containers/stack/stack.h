@@ -1,5 +1,7 @@
 #ifndef STACK_H
 #define STACK_H
+#include <type_traits>
+
 #include "../list/list.h"
 namespace s21 {
 template <typename T, typename Container = s21::List<T>>
@@ -9,6 +11,7 @@ class Stack {
   using reference = typename Container::reference;
   using const_reference = typename Container::const_reference;
   using size_type = typename Container::size_type;
+  using stats_key = typename stats::detail::KeyOf<Container>::type;
 
  protected:
   Container cont;
@@ -16,6 +19,10 @@ class Stack {
  public:
   Stack() : cont() {}
   Stack(std::initializer_list<value_type> const &items) : cont(items) {}
+  // Builds the underlying container with alloc, e.g. a pmr resource.
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator_v<Container, Alloc>>>
+  explicit Stack(const Alloc &alloc) : cont(alloc) {}
   Stack(const Stack &s) : cont(s.cont) {}
   Stack(Stack &&s) noexcept : cont(std::move(s.cont)) {}
   ~Stack(){};
@@ -28,6 +35,7 @@ class Stack {
 
   bool empty() { return cont.empty(); }
   size_type size() { return cont.size(); }
+  stats::Counters alloc_stats() const { return stats::of(cont); }
 
   void push(const_reference value) { this->cont.push_back(value); }
   void pop() { this->cont.pop_back(); }
@@ -38,5 +46,10 @@ template class Stack<int>;
 template class Stack<double>;
 template class Stack<char>;
 template class Stack<float>;
+
+namespace pmr {
+template <typename T>
+using Stack = s21::Stack<T, pmr::List<T>>;
+}  // namespace pmr
 }  // namespace s21
 #endif  // STACK_H
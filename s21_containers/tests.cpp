@@ -1,8 +1,37 @@
+#include "array/array.h"
 #include "list/list.h"
+#include "memory/aligned_allocator.h"
+#include "memory/memory_resource.h"
 #include "vector/vector.h"
+#include "vector/cow_vector.h"
 #include "stack/stack.h"
 #include "queue/queue.h"
+#include "simd/simd.h"
+#include "priorityQueue/indexed_priority_queue.h"
+#include "setMap/map/s21_map.tpp"
+#include "setMap/multimap/s21_multimap.tpp"
+#include "setMap/multiset/s21_multiset.tpp"
+#include "setMap/set/s21_set.tpp"
+#include "setMap/interval/s21_interval_map.h"
+#include "setMap/persistent/s21_persistent_map.h"
+#include "setMap/persistent/s21_persistent_set.h"
+#include "setMap/concurrent/s21_concurrent_map.h"
+#include "setMap/concurrent/s21_sharded_map.h"
+#include "setMap/concurrent/s21_concurrent_set.h"
+#include "concurrency/epoch.h"
+#include "concurrency/thread_pool.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <set>
 #include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <string>
+#include <string_view>
 #include <gtest/gtest.h>
 namespace s21 {
 class ListTest : public ::testing::Test {
@@ -373,6 +402,1597 @@ TEST(VectorTest, Swap) {
 }
 
 
+// Тестирование вектора с нетривиальным типом элементов
+TEST(VectorTest, NonTrivialElements) {
+  s21::Vector<std::string> v({"a", "b"});
+  v.push_back(std::string(100, 'c'));
+  v.push_back(v[0]);
+  v.insert(v.begin() + 1, "x");
+  v.erase(v.begin());
+  EXPECT_EQ(v.size(), 4);
+  EXPECT_EQ(v[0], "x");
+  EXPECT_EQ(v[2], std::string(100, 'c'));
+  EXPECT_EQ(v.back(), "a");
+  s21::Vector<std::string> copy(v);
+  v.clear();
+  EXPECT_EQ(copy[1], "b");
+}
+
+// Тестирование выравнивания хранилища
+TEST(VectorTest, AlignedAllocator) {
+  s21::Vector<int, s21::AlignedAllocator<int, 64>> v;
+  for (int i = 0; i < 100; ++i) {
+    v.push_back(i);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(v.data()) % 64, 0u);
+  }
+  EXPECT_EQ(v[99], 99);
+  v.shrink_to_fit();
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(v.data()) % 64, 0u);
+
+  s21::Vector<char, s21::AlignedAllocator<char, 64, true>> huge(
+      s21::kHugePageSize + 1);
+  EXPECT_EQ(
+      reinterpret_cast<std::uintptr_t>(huge.data()) % s21::kHugePageSize, 0u);
+  EXPECT_EQ(huge[s21::kHugePageSize], 0);
+}
+
+// Stateful allocator that counts live allocations in a shared counter.
+// Instances with different ids compare unequal and do not propagate on
+// move assignment, which forces containers onto the element-wise path.
+template <class T>
+struct CountingAllocator {
+  using value_type = T;
+  using propagate_on_container_move_assignment = std::false_type;
+  using propagate_on_container_swap = std::true_type;
+
+  explicit CountingAllocator(int *live, int id = 0) : live(live), id(id) {}
+  template <class U>
+  CountingAllocator(const CountingAllocator<U> &other)
+      : live(other.live), id(other.id) {}
+
+  T *allocate(std::size_t n) {
+    ++*live;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, std::size_t n) {
+    --*live;
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  int *live;
+  int id;
+};
+
+template <class T, class U>
+bool operator==(const CountingAllocator<T> &a, const CountingAllocator<U> &b) {
+  return a.id == b.id;
+}
+template <class T, class U>
+bool operator!=(const CountingAllocator<T> &a, const CountingAllocator<U> &b) {
+  return a.id != b.id;
+}
+
+// Heap-backed resource that counts the bytes it has outstanding. Distinct
+// instances compare unequal, like two arenas would.
+class CountingResource : public pmr::MemoryResource {
+ public:
+  long live = 0;
+
+ private:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+    live += static_cast<long>(bytes);
+    return pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void *p, std::size_t bytes,
+                     std::size_t alignment) override {
+    live -= static_cast<long>(bytes);
+    pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+  bool do_is_equal(const pmr::MemoryResource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+TEST(SetTest, RandomInsertErase) {
+  Set<int> s;
+  for (int i = 0; i < 2000; ++i) s.insert((i * 7919) % 2000);
+  EXPECT_EQ(s.size(), 2000u);
+  for (int i = 0; i < 2000; i += 2) s.erase(s.find(i));
+  EXPECT_EQ(s.size(), 1000u);
+  int expected = 1;
+  for (int value : s) {
+    EXPECT_EQ(value, expected);
+    expected += 2;
+  }
+  EXPECT_EQ(expected, 2001);
+}
+
+// Ascending inserts of 2^k - 1 keys leave an AVL tree perfectly balanced.
+TEST(SetTest, TreeStats) {
+  Set<int> s;
+  EXPECT_EQ(s.tree_stats().height, 0);
+  for (int i = 0; i < 1023; ++i) s.insert(i);
+  for (int i = 0; i < 1023; ++i) s.contains(i);
+  TreeStats stats = s.tree_stats();
+  EXPECT_EQ(stats.size, 1023u);
+  EXPECT_EQ(stats.height, 10);
+  EXPECT_LE(stats.height, stats.height_bound());
+  ASSERT_EQ(stats.depth_histogram.size(), 10u);
+  for (size_t depth = 0; depth < 10; ++depth) {
+    EXPECT_EQ(stats.depth_histogram[depth], size_t(1) << depth);
+  }
+  TreeCounters counters = stats.counters;
+#ifdef S21_TREE_STATS
+  EXPECT_EQ(counters.rotations_right, 0u);
+  EXPECT_GT(counters.rotations_left, 0u);
+  EXPECT_EQ(counters.updates, 1023u);
+  EXPECT_GE(counters.searches, 1023u);
+  EXPECT_EQ(counters.search_depth_max, 10u);
+  EXPECT_LE(counters.average_search_depth(), 10.0);
+  EXPECT_GT(counters.rebalance_path_max, 0u);
+#else
+  EXPECT_EQ(counters.rotations(), 0u);
+  EXPECT_EQ(counters.searches, 0u);
+#endif
+
+  Map<int, int> m({{1, 1}, {2, 2}, {3, 3}});
+  EXPECT_EQ(m.tree_stats().height, 2);
+  EXPECT_EQ(m.tree_stats().depth_histogram[1], 2u);
+}
+
+TEST(SetTest, Bounds) {
+  Set<int> s;
+  std::set<int> expected;
+  for (int i = 0; i < 500; ++i) {
+    s.insert((i * 7919) % 1000 * 2);
+    expected.insert((i * 7919) % 1000 * 2);
+  }
+  for (int key = -3; key < 2003; ++key) {
+    auto lower = expected.lower_bound(key);
+    auto upper = expected.upper_bound(key);
+    if (lower == expected.end()) {
+      EXPECT_EQ(s.lower_bound(key), s.end());
+    } else {
+      EXPECT_EQ(*s.lower_bound(key), *lower);
+    }
+    if (upper == expected.end()) {
+      EXPECT_EQ(s.upper_bound(key), s.end());
+    } else {
+      EXPECT_EQ(*s.upper_bound(key), *upper);
+    }
+    auto range = s.equal_range(key);
+    EXPECT_EQ(range.first, s.lower_bound(key));
+    EXPECT_EQ(range.second, s.upper_bound(key));
+  }
+  auto last = s.lower_bound(5000);
+  EXPECT_EQ(*--last, *expected.rbegin());
+}
+
+TEST(SetTest, Range) {
+  Set<int> s;
+  for (int i = 0; i < 100; ++i) s.insert(i * 3);
+  Vector<int> seen;
+  for (int key : s.range(10, 31)) seen.push_back(key);
+  ASSERT_EQ(seen.size(), 7u);
+  for (size_t i = 0; i < seen.size(); ++i) {
+    EXPECT_EQ(seen[i], 12 + 3 * static_cast<int>(i));
+  }
+  EXPECT_TRUE(s.range(31, 10).empty());
+  EXPECT_TRUE(s.range(13, 15).empty());
+  EXPECT_TRUE(s.range(500, 600).empty());
+  int count = 0;
+  for (int key : s.range(-10, 1000)) count += key >= 0;
+  EXPECT_EQ(count, 100);
+  Set<int> empty;
+  EXPECT_TRUE(empty.range(0, 10).empty());
+  EXPECT_EQ(empty.lower_bound(0), empty.end());
+}
+
+// Brute force over a shadow std::set through inserts, erases and the
+// rotations they trigger.
+TEST(SetTest, RangeAggregates) {
+  Set<int, std::less<int>, std::allocator<int>, aggregate::Sum<long>> sums;
+  Set<int, std::less<int>, std::allocator<int>, aggregate::Min<int>> mins;
+  Set<int, std::less<int>, std::allocator<int>, aggregate::Max<int>> maxes;
+  std::set<int> expected;
+  for (int i = 0; i < 3000; ++i) {
+    int key = (i * 7919) % 1500;
+    if (i % 3 == 2) {
+      sums.erase(sums.find(key));
+      mins.erase(mins.find(key));
+      maxes.erase(maxes.find(key));
+      expected.erase(key);
+    } else {
+      sums.insert(key);
+      mins.insert(key);
+      maxes.insert(key);
+      expected.insert(key);
+    }
+    if (i % 97) continue;
+    for (int lo = -5; lo < 1505; lo += 37) {
+      int hi = lo + i % 400;
+      long sum = 0;
+      int count = 0;
+      int low = std::numeric_limits<int>::max();
+      int high = std::numeric_limits<int>::lowest();
+      for (auto it = expected.lower_bound(lo);
+           it != expected.end() && *it < hi; ++it) {
+        sum += *it;
+        ++count;
+        low = std::min(low, *it);
+        high = std::max(high, *it);
+      }
+      EXPECT_EQ(sums.count_range(lo, hi), size_t(count));
+      EXPECT_EQ(sums.aggregate_range(lo, hi), sum);
+      EXPECT_EQ(mins.aggregate_range(lo, hi), low);
+      EXPECT_EQ(maxes.aggregate_range(lo, hi), high);
+    }
+  }
+  Set<int, std::less<int>, std::allocator<int>, aggregate::Sum<long>> copy(
+      sums);
+  EXPECT_EQ(copy.aggregate_range(0, 1500), sums.aggregate_range(0, 1500));
+  EXPECT_EQ(Set<int>({1, 2, 3}).count_range(2, 10), 2u);
+}
+
+// Found by id alone: an Employee cannot even be built from an int, so
+// these lookups must not construct a key.
+struct Employee {
+  int id;
+  std::string name;
+};
+struct ById {
+  using is_transparent = void;
+  bool operator()(const Employee& a, const Employee& b) const {
+    return a.id < b.id;
+  }
+  bool operator()(const Employee& a, int id) const { return a.id < id; }
+  bool operator()(int id, const Employee& b) const { return id < b.id; }
+};
+
+TEST(SetTest, TransparentLookup) {
+  Set<Employee, ById> staff;
+  for (int id = 0; id < 100; id += 2) {
+    staff.insert(Employee{id, "e" + std::to_string(id)});
+  }
+  EXPECT_TRUE(staff.contains(42));
+  EXPECT_FALSE(staff.contains(43));
+  EXPECT_EQ(staff.find(42)->name, "e42");
+  EXPECT_EQ(staff.find(43), staff.end());
+  EXPECT_EQ(staff.lower_bound(43)->id, 44);
+  EXPECT_EQ(staff.upper_bound(44)->id, 46);
+  auto range = staff.equal_range(10);
+  EXPECT_EQ(range.first->id, 10);
+  EXPECT_EQ(range.second->id, 12);
+  EXPECT_EQ(staff.erase(42), 1u);
+  EXPECT_EQ(staff.erase(42), 0u);
+  EXPECT_EQ(staff.size(), 49u);
+
+  Set<std::string, std::less<>> words({"apple", "banana", "cherry"});
+  std::string_view banana = "banana";
+  EXPECT_TRUE(words.contains(banana));
+  EXPECT_EQ(*words.find(banana), "banana");
+  EXPECT_EQ(*words.lower_bound(std::string_view("b")), "banana");
+  EXPECT_EQ(words.erase(std::string_view("apple")), 1u);
+  EXPECT_EQ(words.erase(std::string("kiwi")), 0u);
+  EXPECT_EQ(words.size(), 2u);
+}
+
+TEST(SetTest, CustomCompare) {
+  Set<int, std::greater<int>, std::allocator<int>, aggregate::Sum<long>> s(
+      std::greater<int>{});
+  for (int i = 0; i < 10; ++i) s.insert(i);
+  int expected = 9;
+  for (int key : s) EXPECT_EQ(key, expected--);
+  EXPECT_EQ(*s.lower_bound(4), 4);
+  EXPECT_EQ(*s.upper_bound(4), 3);
+  EXPECT_EQ(s.count_range(7, 2), 5u);
+  EXPECT_EQ(s.aggregate_range(7, 2), 7 + 6 + 5 + 4 + 3);
+  EXPECT_TRUE(s.range(2, 7).empty());
+  s.erase(s.find(5));
+  EXPECT_FALSE(s.contains(5));
+  Set<int, std::greater<int>, std::allocator<int>, aggregate::Sum<long>> copy(
+      s);
+  EXPECT_EQ(*copy.begin(), 9);
+  EXPECT_EQ(copy.size(), 9u);
+}
+
+// Counts its calls, to pin the tree to one comparison per level.
+struct CountingLess {
+  bool operator()(int a, int b) const {
+    ++*calls;
+    return a < b;
+  }
+  size_t* calls;
+};
+
+TEST(SetTest, ComparisonsPerLevel) {
+  size_t calls = 0;
+  Set<int, CountingLess> s(CountingLess{&calls});
+  for (int i = 0; i < 1023; ++i) s.insert(i);
+  const size_t height = s.tree_stats().height;
+  for (int i = 0; i < 1023; ++i) {
+    calls = 0;
+    auto [it, inserted] = s.insert(i);
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(*it, i);
+    EXPECT_LE(calls, height + 1);
+    calls = 0;
+    EXPECT_TRUE(s.contains(i));
+    EXPECT_LE(calls, height + 1);
+  }
+  calls = 0;
+  s.erase(512);
+  EXPECT_LE(calls, height + 1);
+  EXPECT_FALSE(s.contains(512));
+}
+
+TEST(MapTest, ClearAndMerge) {
+  Map<int, int> a({{1, 10}, {2, 20}, {3, 30}});
+  Map<int, int> b({{3, 0}, {4, 40}, {5, 50}});
+  a.merge(b);
+  EXPECT_EQ(a.size(), 5u);
+  EXPECT_EQ(a.at(3), 30);
+  EXPECT_EQ(b.size(), 1u);
+  a.clear();
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(MapTest, AccessOnEmptyMap) {
+  Map<int, int> m;
+  EXPECT_THROW(m.at(1), std::invalid_argument);
+  m[1] += 5;
+  EXPECT_EQ(m.size(), 1u);
+  EXPECT_EQ(m.at(1), 5);
+}
+
+// Values out of key order: bounds must ignore mapped values.
+TEST(MapTest, Bounds) {
+  Map<int, int> m({{10, 9}, {20, 1}, {30, 5}, {40, 0}});
+  EXPECT_EQ(m.lower_bound(20)->first, 20);
+  EXPECT_EQ(m.lower_bound(21)->first, 30);
+  EXPECT_EQ(m.upper_bound(20)->first, 30);
+  EXPECT_EQ(m.upper_bound(40), m.end());
+  EXPECT_EQ(m.lower_bound(0)->first, 10);
+  auto range = m.equal_range(30);
+  EXPECT_EQ(range.first->second, 5);
+  EXPECT_EQ(range.second->first, 40);
+  range = m.equal_range(35);
+  EXPECT_EQ(range.first, range.second);
+  int sum = 0;
+  for (auto &item : m.range(15, 40)) sum += item.second += 100;
+  EXPECT_EQ(sum, 206);
+  EXPECT_EQ(m.at(30), 105);
+  EXPECT_EQ(m.at(40), 0);
+}
+
+TEST(MapTest, RangeAggregates) {
+  Map<int, int, std::less<int>, std::allocator<std::pair<const int, int>>,
+      aggregate::Sum<long>>
+      m;
+  for (int i = 0; i < 100; ++i) m.insert(i, i * 10);
+  EXPECT_EQ(m.count_range(10, 20), 10u);
+  EXPECT_EQ(m.aggregate_range(10, 20), 1450);
+  m.insert_or_assign(15, 0);
+  m.insert_or_assign(200, 7);
+  EXPECT_EQ(m.aggregate_range(10, 20), 1300);
+  EXPECT_EQ(m.aggregate_range(100, 300), 7);
+  EXPECT_EQ(m.aggregate_range(20, 10), 0);
+  m.erase(m.lower_bound(0));
+  EXPECT_EQ(m.count_range(0, 300), 100u);
+  EXPECT_EQ(m.aggregate_range(0, 10), 450);
+}
+
+TEST(MapTest, AggregatesSurviveWrites) {
+  using SumMap =
+      Map<int, int, std::less<int>, std::allocator<std::pair<const int, int>>,
+          aggregate::Sum<long>>;
+  // Writes that could not refresh the aggregates do not compile.
+  static_assert(std::is_same_v<decltype(std::declval<SumMap &>()[0]),
+                               const int &>);
+  static_assert(std::is_same_v<decltype(std::declval<SumMap &>().at(0)),
+                               const int &>);
+  static_assert(
+      std::is_same_v<decltype(*std::declval<SumMap &>().begin()),
+                     const std::pair<const int, int> &>);
+  static_assert(std::is_same_v<decltype(std::declval<Map<int, int> &>()[0]),
+                               int &>);
+
+  SumMap m;
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(m[i], 0);
+  for (int i = 0; i < 100; ++i) m.modify(i, [](int &v) { v = 2; });
+  EXPECT_EQ(m.aggregate_range(0, 100), 200);
+  for (const auto &item : m) m.modify(item.first, [](int &v) { ++v; });
+  EXPECT_EQ(m.aggregate_range(0, 100), 300);
+  EXPECT_EQ(m.aggregate_range(10, 20), 30);
+  EXPECT_THROW(m.modify(100, [](int &v) { v = 1; }), std::invalid_argument);
+  EXPECT_THROW(m.modify(5,
+                        [](int &v) {
+                          v = 50;
+                          throw std::runtime_error("late");
+                        }),
+               std::runtime_error);
+  EXPECT_EQ(m.aggregate_range(0, 10), 9 * 3 + 50);
+}
+
+TEST(MapTest, TransparentLookup) {
+  Map<std::string, int, std::less<>> m({{"one", 1}, {"two", 2}, {"three", 3}});
+  std::string_view two = "two";
+  EXPECT_TRUE(m.contains(two));
+  EXPECT_EQ(m.find(two)->second, 2);
+  EXPECT_EQ(m.find(std::string_view("four")), m.end());
+  EXPECT_EQ(m.lower_bound(std::string_view("p"))->first, "three");
+  EXPECT_EQ(m.erase(std::string_view("one")), 1u);
+  EXPECT_FALSE(m.contains(std::string_view("one")));
+  EXPECT_EQ(m.at("three"), 3);
+  EXPECT_EQ(m.size(), 2u);
+
+  Map<int, int, std::greater<int>> reversed;
+  for (int i = 0; i < 5; ++i) reversed[i] = i * i;
+  EXPECT_EQ(reversed.begin()->first, 4);
+  EXPECT_EQ(reversed.lower_bound(2)->second, 4);
+  EXPECT_EQ(reversed.erase(4), 1u);
+  EXPECT_EQ(reversed.begin()->first, 3);
+}
+
+// The tree orders by key alone, so values without operator< are fine.
+TEST(MapTest, MappedValuesNeedNotCompare) {
+  Map<int, List<int>> m;
+  for (int i = 0; i < 100; ++i) m[i % 10].push_back(i);
+  EXPECT_EQ(m.size(), 10u);
+  EXPECT_EQ(m.at(3).size(), 10u);
+  EXPECT_EQ(m.find(7)->second.front(), 7);
+  EXPECT_FALSE(m.insert(3, List<int>()).second);
+  EXPECT_EQ(m.erase(3), 1u);
+  EXPECT_EQ(m.find(3), m.end());
+}
+
+// Counts how many mapped values were built.
+struct Built {
+  explicit Built(int value) : value(value) { ++count; }
+  int value;
+  static inline int count = 0;
+};
+
+TEST(MapTest, Emplace) {
+  Map<int, Built> m;
+  Built::count = 0;
+  EXPECT_TRUE(m.try_emplace(1, 10).second);
+  EXPECT_FALSE(m.try_emplace(1, 20).second);
+  EXPECT_EQ(Built::count, 1);
+  EXPECT_EQ(m.at(1).value, 10);
+  auto [it, inserted] = m.emplace(2, 30);
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ(it->second.value, 30);
+  EXPECT_FALSE(m.emplace(2, 40).second);
+  EXPECT_EQ(m.find(2)->second.value, 30);
+
+  Map<std::string, std::string> names;
+  std::string key = "k";
+  names.try_emplace(std::move(key), 3, 'x');
+  EXPECT_EQ(names.at("k"), "xxx");
+  EXPECT_EQ(names.insert("k", "y").first->second, "xxx");
+  EXPECT_EQ(names.insert_or_assign("k", "y").first->second, "y");
+  EXPECT_EQ(names["z"], "");
+  EXPECT_EQ(names.size(), 2u);
+}
+
+// The node travels between maps: same address, no new allocation.
+TEST(MapTest, NodeHandles) {
+  using SumMap =
+      Map<int, int, std::less<int>, std::allocator<std::pair<const int, int>>,
+          aggregate::Sum<long>>;
+  SumMap a({{1, 10}, {2, 20}, {3, 30}});
+  SumMap b({{3, 300}, {4, 400}});
+  SumMap::node_type handle = a.extract(2);
+  ASSERT_FALSE(handle.empty());
+  EXPECT_EQ(handle.key(), 2);
+  handle.mapped() = 25;
+  const auto* element = &handle.value();
+  const size_t allocations = b.alloc_stats().allocations;
+  auto result = b.insert(std::move(handle));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_TRUE(result.node.empty());
+  EXPECT_EQ(&*result.position, element);
+  EXPECT_EQ(b.alloc_stats().allocations, allocations);
+  EXPECT_EQ(a.size(), 2u);
+  EXPECT_EQ(a.aggregate_range(0, 10), 40);
+  EXPECT_EQ(b.aggregate_range(0, 10), 725);
+
+  result = b.insert(a.extract(a.find(3)));
+  EXPECT_FALSE(result.inserted);
+  ASSERT_FALSE(result.node.empty());
+  EXPECT_EQ(result.node.mapped(), 30);
+  EXPECT_EQ(result.position->second, 300);
+  EXPECT_TRUE(a.extract(99).empty());
+  EXPECT_TRUE(a.extract(a.end()).empty());
+  // Dropping result.node frees the rejected node.
+}
+
+TEST(SetTest, NodeHandles) {
+  Set<std::string> a({"x", "y"});
+  Set<std::string> b;
+  auto handle = a.extract("x");
+  handle.value() += "!";
+  EXPECT_TRUE(b.insert(std::move(handle)).inserted);
+  EXPECT_TRUE(b.contains("x!"));
+  EXPECT_FALSE(a.contains("x"));
+  EXPECT_TRUE(b.emplace(3, 'z').second);
+  EXPECT_FALSE(b.emplace("zzz").second);
+  EXPECT_EQ(b.size(), 2u);
+  EXPECT_TRUE(b.insert(Set<std::string>::node_type()).position == b.end());
+  if (stats::kEnabled) {
+    // Both emplaces allocated and the rejected one freed its node; the
+    // node from `a` counts as live without having been allocated here.
+    stats::Counters counters = b.alloc_stats();
+    EXPECT_EQ(counters.allocations, 2u);
+    EXPECT_EQ(counters.deallocations, 1u);
+    EXPECT_EQ(counters.live_bytes,
+              2 * (counters.bytes_allocated - counters.bytes_deallocated));
+  }
+}
+
+TEST(SetTest, PmrNodeHandles) {
+  CountingResource resource;
+  {
+    pmr::Set<int> s({1, 2, 3}, &resource);
+    pmr::Set<int>::node_type handle;
+    handle = s.extract(2);
+    EXPECT_EQ(handle.get_allocator().resource(), &resource);
+    pmr::Set<int>::node_type other;
+    other = std::move(handle);
+    EXPECT_TRUE(handle.empty());
+    other = s.extract(3);  // Frees the node holding 2.
+    EXPECT_EQ(other.value(), 3);
+    EXPECT_TRUE(s.insert(std::move(other)).inserted);
+    EXPECT_EQ(s.size(), 2u);
+  }
+  EXPECT_EQ(resource.live, 0);
+}
+
+// Checked against a shadow std::set: the joins that put the tree back
+// together must keep it balanced and its sums current.
+TEST(SetTest, EraseIfAndRange) {
+  Set<int, std::less<int>, std::allocator<int>, aggregate::Sum<long>> s;
+  std::set<int> expected;
+  for (int i = 0; i < 1000; ++i) {
+    s.insert((i * 7919) % 1000);
+    expected.insert(i);
+  }
+  EXPECT_EQ(s.erase_if([](int key) { return key % 10 < 3; }), 300u);
+  for (int i = 0; i < 1000; i += 10) {
+    for (int j = i; j < i + 3; ++j) expected.erase(j);
+  }
+  auto matches = [&] {
+    TreeStats stats = s.tree_stats();
+    EXPECT_LE(stats.height, stats.height_bound());
+    EXPECT_EQ(s.size(), expected.size());
+    auto it = expected.begin();
+    for (int key : s) EXPECT_EQ(key, *it++);
+    long sum = 0;
+    for (int key : expected) sum += key;
+    EXPECT_EQ(s.aggregate_range(0, 1000), sum);
+  };
+  matches();
+  auto last = s.erase(s.find(103), s.find(107));
+  EXPECT_EQ(*last, 107);
+  expected.erase(expected.find(103), expected.find(107));
+  matches();
+  EXPECT_EQ(s.erase(s.lower_bound(200), s.end()), s.end());
+  expected.erase(expected.lower_bound(200), expected.end());
+  matches();
+  EXPECT_EQ(s.erase(s.begin(), s.begin()), s.begin());
+  // A throwing predicate keeps whatever it has not been asked about.
+  int calls = 0;
+  auto fifth_throws = [&calls](int) -> bool {
+    if (++calls == 5) throw std::runtime_error("stop");
+    return true;
+  };
+  EXPECT_THROW(s.erase_if(fifth_throws), std::runtime_error);
+  for (int i = 0; i < 4; ++i) expected.erase(expected.begin());
+  matches();
+}
+
+// Copies fail on the copies_left-th element; the half-built tree must not
+// leak. Counted with atomics as parallel copies make them on pool threads.
+struct Fragile {
+  Fragile(int value = 0) : value(value) { ++alive; }
+  Fragile(const Fragile &other) : value(other.value) {
+    if (copies_left > 0 && --copies_left == 0) throw std::runtime_error("copy");
+    ++alive;
+  }
+  ~Fragile() { --alive; }
+  bool operator<(const Fragile &other) const { return value < other.value; }
+
+  int value;
+  static inline std::atomic<int> copies_left{0};
+  static inline std::atomic<int> alive{0};
+};
+
+TEST(SetTest, FailedCopyFreesWhatItBuilt) {
+  int live = 0;
+  using FragileSet =
+      Set<Fragile, std::less<Fragile>, CountingAllocator<Fragile>>;
+  FragileSet s{CountingAllocator<Fragile>(&live)};
+  for (int i = 0; i < 1000; ++i) s.emplace((i * 7919) % 1000);
+  EXPECT_EQ(live, 1000);
+  Fragile::copies_left = 600;
+  EXPECT_THROW(FragileSet copy(s), std::runtime_error);
+  EXPECT_EQ(live, 1000);
+  FragileSet copy(s);
+  EXPECT_EQ(live, 2000);
+  EXPECT_EQ(copy.tree_stats().height, s.tree_stats().height);
+  int expected = 0;
+  for (const Fragile &item : copy) EXPECT_EQ(item.value, expected++);
+  copy.clear();
+  EXPECT_EQ(live, 1000);
+}
+
+// Above the threshold the subtrees a few levels down are copied and freed
+// on the pool; the result must be the same tree, counted the same way.
+TEST(SetTest, ParallelCopyAndClear) {
+  ThreadPool pool(3);
+  tree_parallel::Guard parallel(pool, 1000);
+  using SumSet =
+      Set<int, std::less<int>, std::allocator<int>, aggregate::Sum<long>>;
+  SumSet s;
+  for (int i = 0; i < 20000; ++i) s.insert((i * 7919) % 20000);
+  SumSet copy(s);
+  EXPECT_EQ(copy.size(), 20000u);
+  TreeStats shape = copy.tree_stats();
+  TreeStats source = s.tree_stats();
+  ASSERT_EQ(shape.depth_histogram.size(), source.depth_histogram.size());
+  for (size_t depth = 0; depth < shape.depth_histogram.size(); ++depth) {
+    EXPECT_EQ(shape.depth_histogram[depth], source.depth_histogram[depth]);
+  }
+  EXPECT_EQ(copy.aggregate_range(100, 5000), s.aggregate_range(100, 5000));
+  int expected = 0;
+  for (int key : copy) EXPECT_EQ(key, expected++);
+  if (stats::kEnabled) {
+    EXPECT_EQ(copy.alloc_stats().allocations, 20000u);
+    copy.clear();
+    EXPECT_EQ(copy.alloc_stats().deallocations, 20000u);
+    EXPECT_EQ(copy.alloc_stats().live_bytes, 0u);
+  }
+
+  Set<Fragile> fragile;
+  for (int i = 0; i < 5000; ++i) fragile.emplace(i);
+  Fragile::copies_left = 3000;
+  EXPECT_THROW(Set<Fragile> failed(fragile), std::runtime_error);
+  EXPECT_EQ(Fragile::alive, 5000);
+  Fragile::copies_left = 0;
+  {
+    Set<Fragile> fine(fragile);
+    EXPECT_EQ(Fragile::alive, 10000);
+  }
+  EXPECT_EQ(Fragile::alive, 5000);
+  fragile.clear();
+  EXPECT_EQ(Fragile::alive, 0);
+}
+
+TEST(MapTest, EraseIfAndRange) {
+  Map<int, std::string> m;
+  for (int i = 0; i < 100; ++i) m.insert(i, std::to_string(i));
+  auto one_digit = [](std::pair<const int, std::string> &item) {
+    return item.second.size() == 1;
+  };
+  EXPECT_EQ(m.erase_if(one_digit), 10u);
+  EXPECT_EQ(m.begin()->first, 10);
+  EXPECT_EQ(m.erase(m.find(20), m.find(90))->second, "90");
+  EXPECT_EQ(m.size(), 20u);
+  EXPECT_EQ(m.at(19), "19");
+  EXPECT_FALSE(m.contains(50));
+  m.erase(m.begin(), m.end());
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.erase_if([](auto &) { return true; }), 0u);
+}
+
+TEST(PersistentTest, VersionsStayValid) {
+  PersistentSet<int> v;
+  Vector<PersistentSet<int>> versions;
+  for (int i = 0; i < 100; ++i) {
+    v = v.insert((i * 37) % 100);
+    versions.push_back(v);
+  }
+  PersistentSet<int> odd = v;
+  for (int i = 0; i < 100; i += 2) odd = odd.erase(i);
+
+  EXPECT_EQ(v.size(), 100u);
+  EXPECT_EQ(odd.size(), 50u);
+  for (size_t i = 0; i < versions.size(); ++i) {
+    EXPECT_EQ(versions[i].size(), i + 1);
+  }
+  int expected = 0;
+  for (int value : v) EXPECT_EQ(value, expected++);
+  expected = 1;
+  for (int value : odd) {
+    EXPECT_EQ(value, expected);
+    expected += 2;
+  }
+  EXPECT_TRUE(v.contains(42));
+  EXPECT_FALSE(odd.contains(42));
+  EXPECT_EQ(*odd.find(41), 41);
+  EXPECT_EQ(++odd.find(41), odd.find(43));
+  EXPECT_EQ(odd.find(42), odd.end());
+  EXPECT_TRUE(v.insert(5).shares_root(v));
+  EXPECT_TRUE(odd.erase(4).shares_root(odd));
+  EXPECT_LE(v.height(), 8);
+}
+
+TEST(PersistentTest, UpdatesShareUntouchedNodes) {
+  int live = 0;
+  {
+    using Alloc = CountingAllocator<int>;
+    PersistentSet<int, Alloc> v{Alloc(&live)};
+    for (int i = 0; i < 1023; ++i) v = v.insert(i);
+    EXPECT_EQ(live, 1023);
+    PersistentSet<int, Alloc> inserted = v.insert(5000);
+    EXPECT_LE(live - 1023, v.height() + 1);
+    int before = live;
+    PersistentSet<int, Alloc> erased = inserted.erase(511);
+    EXPECT_LE(live - before, 2 * v.height());
+    EXPECT_EQ(v.size(), 1023u);
+    EXPECT_EQ(inserted.size(), 1024u);
+    EXPECT_EQ(erased.size(), 1023u);
+    EXPECT_TRUE(v.contains(511));
+    EXPECT_FALSE(erased.contains(511));
+    v = PersistentSet<int, Alloc>{Alloc(&live)};
+    EXPECT_TRUE(inserted.contains(0));
+  }
+  EXPECT_EQ(live, 0);
+}
+
+TEST(PersistentTest, AssignAcrossResources) {
+  CountingResource first, second;
+  {
+    pmr::PersistentMap<int, int> a(&first), b(&second);
+    b = b.insert(1, 1).insert(2, 2);
+    const long built = second.live;
+    a = b;
+    EXPECT_EQ(a.at(2), 2);
+    EXPECT_EQ(first.live, built);
+    EXPECT_EQ(second.live, built);
+
+    pmr::PersistentMap<int, int> shared(&first);
+    shared = a;
+    EXPECT_EQ(first.live, built);
+
+    pmr::PersistentMap<int, int> moved(&first);
+    moved = std::move(b);
+    EXPECT_EQ(moved.at(1), 1);
+    EXPECT_EQ(first.live, 2 * built);
+    EXPECT_EQ(second.live, 0);
+  }
+  EXPECT_EQ(first.live, 0);
+  EXPECT_EQ(second.live, 0);
+}
+
+TEST(PersistentTest, MatchesStdSetHistory) {
+  PersistentSet<int> v;
+  Vector<PersistentSet<int>> versions;
+  std::set<int> model;
+  Vector<std::set<int>> models;
+  unsigned seed = 7;
+  for (int i = 0; i < 3000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int key = static_cast<int>((seed >> 16) % 500);
+    if (seed & 1) {
+      v = v.erase(key);
+      model.erase(key);
+    } else {
+      v = v.insert(key);
+      model.insert(key);
+    }
+    if (i % 100 == 0) {
+      versions.push_back(v);
+      models.push_back(model);
+    }
+  }
+  for (size_t i = 0; i < versions.size(); ++i) {
+    ASSERT_EQ(versions[i].size(), models[i].size());
+    auto it = models[i].begin();
+    for (int value : versions[i]) EXPECT_EQ(value, *it++);
+    EXPECT_LE(versions[i].height(), 1.45 * std::log2(models[i].size() + 2));
+  }
+}
+
+TEST(PersistentTest, Map) {
+  PersistentMap<int, std::string> a({{1, "one"}, {2, "two"}});
+  PersistentMap<int, std::string> b = a.insert_or_assign(2, "deux");
+  PersistentMap<int, std::string> c = b.insert(3, "three").insert(2, "zwei");
+  EXPECT_EQ(a.at(2), "two");
+  EXPECT_EQ(b.at(2), "deux");
+  EXPECT_EQ(c.at(2), "deux");
+  EXPECT_EQ(c.size(), 3u);
+  EXPECT_EQ(c.find(3)->second, "three");
+  EXPECT_FALSE(c.erase(1).contains(1));
+  EXPECT_TRUE(c.contains(1));
+  EXPECT_THROW(a.at(3), std::invalid_argument);
+}
+
+TEST(PersistentTest, ReadersKeepSnapshots) {
+  PersistentMap<int, int> published;
+  for (int i = 0; i < 1000; ++i) published = published.insert(i, i);
+  const PersistentMap<int, int> snapshot = published;
+  std::thread readers[4];
+  for (auto &reader : readers) {
+    reader = std::thread([&snapshot] {
+      for (int round = 0; round < 20; ++round) {
+        PersistentMap<int, int> mine = snapshot;
+        long sum = 0;
+        for (const auto &entry : mine) sum += entry.second;
+        EXPECT_EQ(sum, 999 * 1000 / 2);
+      }
+    });
+  }
+  for (int i = 0; i < 1000; ++i) {
+    published = published.insert_or_assign(i, -i).erase(i / 2);
+  }
+  for (auto &reader : readers) reader.join();
+  EXPECT_EQ(snapshot.at(500), 500);
+}
+
+TEST(EpochTest, PinnedReaderDelaysReclaim) {
+  static std::atomic<int> reclaimed;
+  reclaimed = 0;
+  std::atomic<bool> pinned{false}, done{false};
+  std::thread reader([&] {
+    epoch::Guard guard;
+    pinned = true;
+    while (!done) std::this_thread::yield();
+  });
+  while (!pinned) std::this_thread::yield();
+
+  epoch::retire(new int(1), [](void *p) {
+    delete static_cast<int *>(p);
+    ++reclaimed;
+  });
+  for (int i = 0; i < 10; ++i) epoch::collect();
+  EXPECT_EQ(reclaimed, 0);
+  done = true;
+  reader.join();
+  epoch::synchronize();
+  EXPECT_EQ(reclaimed, 1);
+}
+
+TEST(MultisetTest, Basic) {
+  Multiset<int> s({3, 1, 3, 2, 3});
+  EXPECT_EQ(s.size(), 5u);
+  EXPECT_EQ(s.count(3), 3u);
+  EXPECT_EQ(s.count(4), 0u);
+  auto results = s.insert_many(1, 4, 1);
+  ASSERT_EQ(results.size(), 3u);
+  EXPECT_TRUE(results[2].second);
+  EXPECT_EQ(*results[1].first, 4);
+  EXPECT_EQ(s.count(1), 3u);
+  auto [first, last] = s.equal_range(3);
+  int threes = 0;
+  for (; first != last; ++first) threes += *first == 3;
+  EXPECT_EQ(threes, 3);
+  EXPECT_EQ(s.erase(1), 3u);
+  EXPECT_FALSE(s.contains(1));
+  s.erase(s.find(3));
+  EXPECT_EQ(s.count(3), 2u);
+  Multiset<int> other({2, 2});
+  s.merge(other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(s.count(2), 3u);
+  EXPECT_EQ(s.size(), 6u);
+}
+
+TEST(MultisetTest, MatchesStdMultiset) {
+  Multiset<int> s;
+  std::multiset<int> expected;
+  for (int i = 0; i < 5000; ++i) {
+    int key = (i * 7919) % 97;
+    switch (i % 5) {
+      case 3:
+        s.erase(s.find(key));
+        if (expected.count(key)) expected.erase(expected.find(key));
+        break;
+      case 4:
+        if (i % 35 == 4) {
+          EXPECT_EQ(s.erase(key), expected.erase(key));
+          break;
+        }
+        [[fallthrough]];
+      default:
+        s.insert(key);
+        expected.insert(key);
+    }
+    EXPECT_EQ(s.count(key), expected.count(key));
+  }
+  ASSERT_EQ(s.size(), expected.size());
+  auto it = expected.begin();
+  for (int key : s) EXPECT_EQ(key, *it++);
+}
+
+// Equal keys keep insertion order, and erasing by iterator removes that
+// element and no other.
+TEST(MultimapTest, Basic) {
+  Multimap<int, std::string> m;
+  m.insert(2, "b1");
+  m.insert_many(std::make_pair(1, "a1"), std::make_pair(2, "b2"),
+                std::make_pair(3, "c1"));
+  m.insert({2, "b3"});
+  EXPECT_EQ(m.count(2), 3u);
+  EXPECT_EQ(m.find(2)->second, "b1");
+  std::string seen;
+  for (auto [it, last] = m.equal_range(2); it != last; ++it) {
+    seen += it->second;
+  }
+  EXPECT_EQ(seen, "b1b2b3");
+  auto middle = m.find(2);
+  ++middle;
+  m.erase(middle);
+  seen.clear();
+  for (auto &item : m) seen += item.second;
+  EXPECT_EQ(seen, "a1b1b3c1");
+  EXPECT_EQ(m.erase(2), 2u);
+  EXPECT_FALSE(m.contains(2));
+  EXPECT_EQ(m.size(), 2u);
+  Multimap<int, std::string> copy(m);
+  EXPECT_EQ(copy.count(1), 1u);
+  Multimap<int, std::string> more({{1, "a2"}, {4, "d1"}, {1, "a3"}});
+  copy.merge(more);
+  EXPECT_TRUE(more.empty());
+  seen.clear();
+  for (auto &item : copy) seen += item.second;
+  EXPECT_EQ(seen, "a1a2a3c1d1");
+}
+
+TEST(IntervalMapTest, Basic) {
+  IntervalMap<int, char> m({{{10, 20}, 'a'}, {{15, 25}, 'b'}, {{30, 40}, 'c'}});
+  EXPECT_THROW(m.insert(5, 5, 'x'), std::invalid_argument);
+  EXPECT_FALSE(m.insert(10, 20, 'z').second);
+  EXPECT_EQ(m.find(10, 20)->second, 'a');
+  EXPECT_EQ(m.find(10, 21), m.end());
+  EXPECT_EQ(m.size(), 3u);
+  std::string seen;
+  for (auto &item : m.overlapping(18, 31)) seen += item.second;
+  EXPECT_EQ(seen, "abc");
+  seen.clear();
+  for (auto &item : m.overlapping(20, 30)) seen += item.second;
+  EXPECT_EQ(seen, "b");
+  EXPECT_FALSE(m.overlaps(25, 30));
+  EXPECT_FALSE(m.overlaps(40, 50));
+  EXPECT_FALSE(m.overlaps(12, 12));
+  EXPECT_EQ(m.erase(15, 25), 1u);
+  EXPECT_EQ(m.erase(15, 25), 0u);
+  EXPECT_FALSE(m.overlaps(20, 30));
+  m.erase(m.begin());
+  EXPECT_EQ(m.begin()->first.lo, 30);
+  m.clear();
+  EXPECT_TRUE(m.empty());
+}
+
+// Every query against a linear scan while intervals come and go.
+TEST(IntervalMapTest, MatchesBruteForce) {
+  IntervalMap<int, int> m;
+  std::set<std::pair<int, int>> expected;
+  std::uint32_t seed = 7;
+  auto next = [&seed](int bound) {
+    seed = seed * 1664525u + 1013904223u;
+    return static_cast<int>((seed >> 8) % bound);
+  };
+  for (int round = 0; round < 4000; ++round) {
+    int lo = next(10000);
+    int hi = lo + 1 + next(round % 2 ? 50 : 2000);
+    if (next(4) == 0 && !expected.empty()) {
+      auto victim = expected.lower_bound({lo, 0});
+      if (victim == expected.end()) victim = expected.begin();
+      EXPECT_EQ(m.erase(victim->first, victim->second), 1u);
+      expected.erase(victim);
+    } else {
+      m.insert(lo, hi, lo ^ hi);
+      expected.insert({lo, hi});
+    }
+    if (round % 40) continue;
+    for (int query = 0; query < 20; ++query) {
+      int from = next(10500) - 250;
+      int to = from + 1 + next(query % 2 ? 10 : 600);
+      Vector<std::pair<int, int>> want;
+      for (const auto &item : expected) {
+        if (item.first < to && from < item.second) want.push_back(item);
+      }
+      Vector<std::pair<int, int>> got;
+      for (const auto &item : m.overlapping(from, to)) {
+        EXPECT_EQ(item.second, item.first.lo ^ item.first.hi);
+        got.push_back({item.first.lo, item.first.hi});
+      }
+      ASSERT_EQ(got.size(), want.size());
+      for (size_t i = 0; i < got.size(); ++i) EXPECT_EQ(got[i], want[i]);
+      EXPECT_EQ(m.overlaps(from, to), !want.empty());
+    }
+  }
+  EXPECT_EQ(m.size(), expected.size());
+}
+
+TEST(ConcurrentMapTest, Basic) {
+  ConcurrentMap<int, std::string> m{{1, "one"}, {2, "two"}};
+  EXPECT_TRUE(m.insert(3, "three"));
+  EXPECT_FALSE(m.insert(3, "drei"));
+  EXPECT_EQ(m.at(3), "three");
+
+  auto before = m.snapshot();
+  m.insert_or_assign(1, "uno");
+  EXPECT_EQ(m.erase(2), 1u);
+  EXPECT_EQ(m.erase(2), 0u);
+  EXPECT_EQ(m.at(1), "uno");
+  EXPECT_FALSE(m.contains(2));
+  EXPECT_THROW(m.at(2), std::invalid_argument);
+  EXPECT_EQ(before.at(1), "one");
+  EXPECT_EQ(before.size(), 3u);
+
+  m.apply([](const auto &v) { return v.insert(4, "four").insert(5, "five"); });
+  EXPECT_EQ(m.size(), 4u);
+  m.clear();
+  EXPECT_TRUE(m.empty());
+  epoch::synchronize();
+}
+
+TEST(ConcurrentMapTest, ReadersDuringWrites) {
+  // Every published version maps k to k or -k for all k, so no reader may
+  // ever see a missing key or another value.
+  constexpr int kKeys = 256;
+  ConcurrentMap<int, int> m;
+  m.apply([](const auto &v) {
+    auto next = v;
+    for (int k = 1; k <= kKeys; ++k) next = next.insert(k, k);
+    return next;
+  });
+  std::atomic<bool> done{false};
+  std::atomic<int> bad{0};
+  std::thread readers[4];
+  for (int r = 0; r < 4; ++r) {
+    readers[r] = std::thread([&, r] {
+      for (int k = 1 + r; !done; k = k % kKeys + 1) {
+        int value = m.at(k);
+        if (value != k && value != -k) ++bad;
+      }
+    });
+  }
+  for (int i = 0; i < 2000; ++i) {
+    int k = i % kKeys + 1;
+    m.insert_or_assign(k, i % 2 ? k : -k);
+  }
+  done = true;
+  for (auto &reader : readers) reader.join();
+  EXPECT_EQ(bad, 0);
+  epoch::synchronize();
+  EXPECT_EQ(epoch::pending(), 0u);
+}
+
+TEST(ThreadPoolTest, ParallelFor) {
+  ThreadPool pool(3);
+  EXPECT_EQ(pool.concurrency(), 4u);
+  std::atomic<int> hits[100] = {};
+  pool.parallel_for(100, [&](std::size_t i) {
+    // Nested loops run on the caller when every worker is busy.
+    pool.parallel_for(2, [&](std::size_t) { ++hits[i]; });
+  });
+  for (auto &hit : hits) EXPECT_EQ(hit, 2);
+
+  EXPECT_THROW(pool.parallel_for(8,
+                                 [](std::size_t i) {
+                                   if (i == 5) throw std::out_of_range("5");
+                                 }),
+               std::out_of_range);
+  ThreadPool inline_pool(0);
+  int sum = 0;
+  inline_pool.parallel_for(4, [&sum](std::size_t i) { sum += i; });
+  EXPECT_EQ(sum, 6);
+}
+
+TEST(ShardedMapTest, Basic) {
+  ShardedMap<int, std::string, 4> m{{1, "one"}, {2, "two"}};
+  EXPECT_TRUE(m.insert(3, "three"));
+  EXPECT_FALSE(m.insert(3, "drei"));
+  m.insert_or_assign(1, "uno");
+  EXPECT_EQ(m.at(1), "uno");
+  EXPECT_EQ(m.erase(2), 1u);
+  EXPECT_EQ(m.erase(2), 0u);
+  EXPECT_FALSE(m.contains(2));
+  EXPECT_THROW(m.at(2), std::invalid_argument);
+  m.update(4, [](std::string &value) { value += "four"; });
+  EXPECT_EQ(m.at(4), "four");
+  EXPECT_EQ(m.size(), 3u);
+  EXPECT_LT(m.shard_of(4), m.shard_count());
+  m.clear();
+  EXPECT_TRUE(m.empty());
+}
+
+TEST(ShardedMapTest, CountersFromThreads) {
+  ShardedMap<int, int> m;
+  std::thread writers[4];
+  for (auto &writer : writers) {
+    writer = std::thread([&m] {
+      for (int i = 0; i < 1000; ++i) m.update(i % 50, [](int &n) { ++n; });
+    });
+  }
+  for (auto &writer : writers) writer.join();
+
+  std::atomic<int> total{0};
+  std::atomic<std::size_t> keys{0};
+  m.for_each_shard([&](Map<int, int> &shard, std::size_t index) {
+    for (const auto &item : shard) {
+      EXPECT_EQ(m.shard_of(item.first), index);
+      total += item.second;
+    }
+    keys += shard.size();
+  });
+  EXPECT_EQ(total, 4000);
+  EXPECT_EQ(keys, 50u);
+  EXPECT_EQ(m.at(7), 80);
+}
+
+TEST(ConcurrentSetTest, Basic) {
+  ConcurrentSet<int> s{5, 1, 9, 3};
+  EXPECT_TRUE(s.insert(7).second);
+  EXPECT_FALSE(s.insert(7).second);
+  EXPECT_EQ(*s.insert(4).first, 4);
+  EXPECT_EQ(s.size(), 6u);
+  EXPECT_TRUE(s.contains(9));
+  EXPECT_EQ(*s.lower_bound(6), 7);
+  EXPECT_TRUE(s.lower_bound(10) == s.end());
+  EXPECT_EQ(s.erase(5), 1u);
+  EXPECT_EQ(s.erase(5), 0u);
+  s.erase(s.find(1));
+  EXPECT_TRUE(s.find(1) == s.end());
+
+  int expected[] = {3, 4, 7, 9};
+  int i = 0;
+  for (int value : s) EXPECT_EQ(value, expected[i++]);
+  EXPECT_EQ(i, 4);
+  s.clear();
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(s.size(), 0u);
+}
+
+TEST(ConcurrentSetTest, MatchesStdSet) {
+  ConcurrentSet<int> s;
+  std::set<int> reference;
+  unsigned state = 12345;
+  for (int i = 0; i < 5000; ++i) {
+    state = state * 1103515245u + 12345u;
+    int key = (state >> 16) % 500;
+    if (state & 1) {
+      EXPECT_EQ(s.insert(key).second, reference.insert(key).second);
+    } else {
+      EXPECT_EQ(s.erase(key), reference.erase(key));
+    }
+  }
+  EXPECT_EQ(s.size(), reference.size());
+  EXPECT_TRUE(std::equal(s.begin(), s.end(), reference.begin(),
+                         reference.end()));
+}
+
+TEST(ConcurrentSetTest, ConcurrentWriters) {
+  // Every thread inserts and erases the same keys, so each insert and each
+  // erase races with three others. An even key may come back after one
+  // thread erased it, but its inserter erases it again later.
+  constexpr int kKeys = 2000;
+  ConcurrentSet<int> s;
+  std::atomic<int> inserted{0}, erased{0};
+  std::thread writers[4];
+  for (auto &writer : writers) {
+    writer = std::thread([&] {
+      for (int k = 0; k < kKeys; ++k) inserted += s.insert(k).second;
+      for (int k = 0; k < kKeys; k += 2) {
+        erased += static_cast<int>(s.erase(k));
+      }
+    });
+  }
+  for (auto &writer : writers) writer.join();
+  EXPECT_GE(inserted, kKeys);
+  EXPECT_EQ(inserted - erased, kKeys / 2);
+  EXPECT_EQ(s.size(), static_cast<std::size_t>(kKeys / 2));
+  int expected = 1;
+  for (int value : s) {
+    EXPECT_EQ(value, expected);
+    expected += 2;
+  }
+  epoch::synchronize();
+}
+
+TEST(ConcurrentSetTest, InsertsRaceErases) {
+  // A few keys churned by every thread at once, so erases keep landing
+  // while inserts are still linking a node's upper levels.
+  constexpr int kKeys = 4;
+  ConcurrentSet<int> s;
+  std::atomic<int> inserted{0}, erased{0};
+  std::thread writers[8];
+  for (int t = 0; t < 8; ++t) {
+    writers[t] = std::thread([&, t] {
+      unsigned state = 2654435761u * (t + 1);
+      for (int i = 0; i < 100000; ++i) {
+        state = state * 1103515245u + 12345u;
+        int key = (state >> 16) % kKeys;
+        if (state & 0x100) {
+          inserted += s.insert(key).second;
+        } else {
+          erased += static_cast<int>(s.erase(key));
+        }
+      }
+    });
+  }
+  for (auto &writer : writers) writer.join();
+  EXPECT_EQ(static_cast<std::size_t>(inserted - erased), s.size());
+  int count = 0, last = -1;
+  for (int value : s) {
+    EXPECT_GT(value, last);
+    last = value;
+    ++count;
+  }
+  EXPECT_EQ(static_cast<std::size_t>(count), s.size());
+  s.clear();
+  epoch::synchronize();
+}
+
+TEST(AllocatorTest, VectorAndList) {
+  int live = 0;
+  {
+    CountingAllocator<int> first(&live, 1), second(&live, 2);
+    Vector<int, CountingAllocator<int>> v({1, 2, 3}, first);
+    List<int, CountingAllocator<int>> l({1, 2, 3}, first);
+    EXPECT_GT(live, 0);
+
+    Vector<int, CountingAllocator<int>> v2(second);
+    List<int, CountingAllocator<int>> l2(second);
+    v2 = std::move(v);
+    l2 = std::move(l);
+    EXPECT_EQ(v2.get_allocator().id, 2);
+    EXPECT_EQ(l2.get_allocator().id, 2);
+    EXPECT_EQ(v2.size(), 3u);
+    EXPECT_EQ(l2.size(), 3u);
+    EXPECT_EQ(l2.back(), 3);
+    EXPECT_TRUE(l.empty());
+
+    List<int, CountingAllocator<int>> l3(l2);
+    l3.merge(l2);
+    EXPECT_EQ(l3.size(), 6u);
+  }
+  EXPECT_EQ(live, 0);
+}
+
+TEST(AllocatorTest, SetAndMap) {
+  int live = 0;
+  {
+    using MapAlloc = CountingAllocator<std::pair<const int, std::string>>;
+    Set<int, std::less<int>, CountingAllocator<int>> s(
+        {5, 3, 8, 1, 4}, CountingAllocator<int>(&live, 1));
+    EXPECT_EQ(live, 5);
+    s.erase(s.find(3));
+    EXPECT_EQ(live, 4);
+    EXPECT_FALSE(s.contains(3));
+    EXPECT_TRUE(s.contains(4));
+
+    Set<int, std::less<int>, CountingAllocator<int>> other(
+        CountingAllocator<int>(&live, 2));
+    other = std::move(s);
+    EXPECT_EQ(other.size(), 4u);
+    EXPECT_EQ(other.get_allocator().id, 2);
+
+    Map<int, std::string, std::less<int>, MapAlloc> m(MapAlloc(&live, 3));
+    m.insert(1, "one");
+    m.insert(2, "two");
+    Map<int, std::string, std::less<int>, MapAlloc> copy(m);
+    EXPECT_EQ(copy.at(2), "two");
+    EXPECT_EQ(copy.get_allocator().id, 3);
+  }
+  EXPECT_EQ(live, 0);
+}
+
+// Counts its copies; moving one is free.
+struct CopyCounted {
+  CopyCounted(int value = 0) : value(value) {}
+  CopyCounted(const CopyCounted &other) : value(other.value) { ++copies; }
+  CopyCounted(CopyCounted &&other) = default;
+  CopyCounted &operator=(const CopyCounted &other) = default;
+  CopyCounted &operator=(CopyCounted &&other) = default;
+  bool operator<(const CopyCounted &other) const {
+    return value < other.value;
+  }
+
+  int value;
+  static inline int copies = 0;
+};
+
+TEST(AllocatorTest, UnequalMoveAssignMovesElements) {
+  int live = 0;
+  {
+    using Alloc = CountingAllocator<CopyCounted>;
+    List<CopyCounted, Alloc> l({1, 2, 3}, Alloc(&live, 1));
+    Set<CopyCounted, std::less<CopyCounted>, Alloc> s({4, 5, 6},
+                                                      Alloc(&live, 1));
+    List<CopyCounted, Alloc> l2(Alloc(&live, 2));
+    Set<CopyCounted, std::less<CopyCounted>, Alloc> s2(Alloc(&live, 2));
+    CopyCounted::copies = 0;
+    l2 = std::move(l);
+    s2 = std::move(s);
+    EXPECT_EQ(CopyCounted::copies, 0);
+    EXPECT_EQ(live, 6);
+    EXPECT_EQ(l2.size(), 3u);
+    EXPECT_EQ(l2.back().value, 3);
+    EXPECT_EQ(s2.size(), 3u);
+    EXPECT_TRUE(s2.contains(CopyCounted(5)));
+  }
+  EXPECT_EQ(live, 0);
+}
+
+TEST(CowVectorTest, CopiesShareUntilWritten) {
+  CowVector<int> a{1, 2, 3};
+  CowVector<int> b(a);
+  const CowVector<int> &view = a;
+  EXPECT_EQ(a.use_count(), 2u);
+  EXPECT_EQ(view.data(), static_cast<const CowVector<int> &>(b).data());
+
+  b.push_back(4);
+  EXPECT_EQ(a.use_count(), 1u);
+  EXPECT_EQ(b.use_count(), 1u);
+  EXPECT_EQ(a.size(), 3u);
+  EXPECT_EQ(b.size(), 4u);
+  EXPECT_EQ(b.back(), 4);
+
+  CowVector<int> c = b;
+  c.erase(c.begin());
+  c.pop_back();
+  EXPECT_EQ(c.front(), 2);
+  EXPECT_EQ(c.size(), 2u);
+  EXPECT_EQ(b.size(), 4u);
+  EXPECT_THROW(view.at(3), std::out_of_range);
+}
+
+TEST(CowVectorTest, ExposedBufferIsNotShared) {
+  CowVector<int> a{1, 2, 3};
+  int &first = a[0];
+  CowVector<int> b(a);
+  EXPECT_EQ(a.use_count(), 1u);
+  first = 10;
+  EXPECT_EQ(b[0], 1);
+
+  // A reallocation drops every outstanding reference, so copies share again.
+  a.reserve(64);
+  CowVector<int> c(a);
+  EXPECT_EQ(c.use_count(), 2u);
+  EXPECT_EQ(*c.cbegin(), 10);
+
+  c.clear();
+  EXPECT_TRUE(c.empty());
+  EXPECT_EQ(a.size(), 3u);
+
+  // insert hands out an iterator even when it had to reallocate.
+  CowVector<int> d{1, 2, 3};
+  auto it = d.insert(d.begin(), 0);
+  CowVector<int> e = d;
+  *it = 42;
+  EXPECT_EQ(e[0], 0);
+  EXPECT_EQ(d[0], 42);
+}
+
+TEST(CowVectorTest, AllocatorAndThreads) {
+  int live = 0;
+  {
+    using Alloc = CountingAllocator<int>;
+    CowVector<int, Alloc> a({1, 2, 3}, Alloc(&live, 1));
+    CowVector<int, Alloc> same(Alloc(&live, 1));
+    same = a;
+    EXPECT_EQ(a.use_count(), 2u);
+    CowVector<int, Alloc> b(Alloc(&live, 2));
+    b = a;
+    EXPECT_EQ(a.use_count(), 2u);
+    EXPECT_EQ(b.use_count(), 1u);
+    b.push_back(4);
+    EXPECT_EQ(b.get_allocator().id, 2);
+    EXPECT_EQ(a.size(), 3u);
+
+    CowVector<int, Alloc> moved(Alloc(&live, 3));
+    moved = std::move(b);
+    EXPECT_EQ(moved.size(), 4u);
+    EXPECT_TRUE(b.empty());
+  }
+  EXPECT_EQ(live, 0);
+
+  const CowVector<int> shared(1000);
+  std::thread readers[4];
+  for (auto &reader : readers) {
+    reader = std::thread([&shared] {
+      for (int i = 0; i < 100; ++i) {
+        CowVector<int> copy(shared);
+        copy.push_back(i);
+        EXPECT_EQ(copy.size(), 1001u);
+      }
+    });
+  }
+  for (auto &reader : readers) reader.join();
+  EXPECT_EQ(shared.use_count(), 1u);
+}
+
+TEST(CowVectorTest, PmrCopyAssign) {
+  CountingResource first, second;
+  {
+    pmr::CowVector<int> b(&second), moved(&second);
+    {
+      pmr::CowVector<int> a({1, 2, 3}, &first), shared(&first);
+      shared = a;
+      EXPECT_EQ(a.use_count(), 2u);
+      b = a;
+      EXPECT_EQ(a.use_count(), 2u);
+      EXPECT_EQ(b.use_count(), 1u);
+      EXPECT_EQ(b.get_allocator().resource(), &second);
+      EXPECT_GT(second.live, 0);
+      moved = std::move(a);
+      EXPECT_EQ(moved.use_count(), 1u);
+      EXPECT_EQ(shared.use_count(), 1u);
+    }
+    // Everything drawn from `first` is gone; the copies stand on their own.
+    EXPECT_EQ(first.live, 0);
+    EXPECT_EQ(b[2], 3);
+    EXPECT_EQ(moved.size(), 3u);
+    b.push_back(4);
+    EXPECT_EQ(b.size(), 4u);
+  }
+  EXPECT_EQ(second.live, 0);
+}
+
+bool InBuffer(const void *p, const unsigned char *buffer, std::size_t size) {
+  auto address = reinterpret_cast<std::uintptr_t>(p);
+  auto begin = reinterpret_cast<std::uintptr_t>(buffer);
+  return address >= begin && address < begin + size;
+}
+
+TEST(MemoryResourceTest, MonotonicBuffer) {
+  alignas(64) unsigned char buffer[4096];
+  pmr::MonotonicBufferResource resource(buffer, sizeof(buffer),
+                                        pmr::null_memory_resource());
+  void *a = resource.allocate(10, 1);
+  void *b = resource.allocate(8, 64);
+  EXPECT_TRUE(InBuffer(a, buffer, sizeof(buffer)));
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b) % 64, 0u);
+  resource.deallocate(b, 8, 64);
+  EXPECT_THROW(resource.allocate(8192), std::bad_alloc);
+
+  resource.release();
+  EXPECT_EQ(resource.allocate(10, 1), a);
+}
+
+TEST(MemoryResourceTest, MonotonicBufferGrowsUpstream) {
+  unsigned char buffer[64];
+  pmr::MonotonicBufferResource resource(buffer, sizeof(buffer));
+  pmr::Vector<int> v(&resource);
+  for (int i = 0; i < 1000; ++i) v.push_back(i);
+  EXPECT_FALSE(InBuffer(v.data(), buffer, sizeof(buffer)));
+  EXPECT_EQ(v[999], 999);
+}
+
+TEST(MemoryResourceTest, PoolReusesBlocks) {
+  pmr::UnsynchronizedPoolResource pool(pmr::PoolOptions{4, 256});
+  EXPECT_EQ(pool.options().largest_required_pool_block, 256u);
+  void *a = pool.allocate(24, 8);
+  void *b = pool.allocate(32, 8);
+  EXPECT_NE(a, b);
+  pool.deallocate(a, 24, 8);
+  EXPECT_EQ(pool.allocate(32, 8), a);
+
+  void *big = pool.allocate(1000, 128);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(big) % 128, 0u);
+  pool.deallocate(big, 1000, 128);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(pool.allocate(64, 64)) % 64,
+              0u);
+  }
+  pool.release();
+}
+
+TEST(MemoryResourceTest, PmrContainers) {
+  alignas(std::max_align_t) unsigned char buffer[1 << 14];
+  pmr::MonotonicBufferResource resource(buffer, sizeof(buffer),
+                                        pmr::null_memory_resource());
+  {
+    pmr::Vector<int> v({1, 2, 3}, &resource);
+    pmr::List<int> l({4, 5, 6}, &resource);
+    pmr::Set<int> s({7, 8, 9}, &resource);
+    pmr::Map<int, int> m(&resource);
+    pmr::Stack<int> st{pmr::PolymorphicAllocator<int>(&resource)};
+    pmr::Queue<int> q{pmr::PolymorphicAllocator<int>(&resource)};
+    m.insert(1, 10);
+    st.push(1);
+    q.push(2);
+    EXPECT_TRUE(InBuffer(v.data(), buffer, sizeof(buffer)));
+    EXPECT_EQ(l.get_allocator().resource(), &resource);
+    EXPECT_TRUE(s.contains(8));
+    EXPECT_EQ(m.at(1), 10);
+    EXPECT_EQ(st.top(), 1);
+    EXPECT_EQ(q.front(), 2);
+
+    pmr::Vector<int> copy(v);
+    EXPECT_EQ(copy.get_allocator().resource(), pmr::get_default_resource());
+    pmr::Vector<int> other(&resource);
+    other = std::move(copy);
+    EXPECT_EQ(other.get_allocator().resource(), &resource);
+    EXPECT_TRUE(InBuffer(other.data(), buffer, sizeof(buffer)));
+  }
+  resource.release();
+}
+
+// Exact counts need -DS21_ALLOC_STATS (make test ALLOC_STATS=1); without it
+// every counter stays zero.
+TEST(AllocStatsTest, VectorInstanceAndType) {
+  stats::reset<Vector<int>>();
+  Vector<int> v;
+  for (int i = 0; i < 100; ++i) v.push_back(i);
+  stats::Counters c = v.alloc_stats();
+  if (!stats::kEnabled) {
+    EXPECT_EQ(c.allocations, 0u);
+    EXPECT_EQ(stats::of<Vector<int>>().allocations, 0u);
+    return;
+  }
+  EXPECT_EQ(c.allocations, c.deallocations + 1);
+  EXPECT_EQ(c.live_bytes, v.capacity() * sizeof(int));
+  EXPECT_EQ(c.bytes_allocated - c.bytes_deallocated, c.live_bytes);
+  EXPECT_GE(c.peak_bytes, c.live_bytes);
+  EXPECT_EQ(stats::of<Vector<int>>().allocations, c.allocations);
+
+  Vector<int> moved(std::move(v));
+  EXPECT_EQ(stats::of(moved).allocations, c.allocations);
+  EXPECT_EQ(v.alloc_stats().allocations, 0u);
+  Vector<int> copy(moved);
+  EXPECT_EQ(copy.alloc_stats().allocations, 1u);
+  EXPECT_EQ(stats::of<Vector<int>>().allocations, c.allocations + 1);
+}
+
+TEST(AllocStatsTest, NodeContainers) {
+  stats::reset<Set<int>>();
+  Set<int> s({1, 2, 3});
+  s.erase(s.begin());
+  Map<int, int> m({{1, 1}, {2, 2}});
+  Stack<int> st;
+  st.push(1);
+  st.push(2);
+  st.pop();
+  if (!stats::kEnabled) {
+    EXPECT_EQ(stats::of(s).allocations, 0u);
+    EXPECT_EQ(stats::total().allocations, 0u);
+    return;
+  }
+  EXPECT_EQ(s.alloc_stats().allocations, 3u);
+  EXPECT_EQ(s.alloc_stats().deallocations, 1u);
+  EXPECT_EQ(stats::of<Set<int>>().live_bytes, s.alloc_stats().live_bytes);
+  EXPECT_EQ(m.alloc_stats().allocations, 2u);
+  EXPECT_EQ(st.alloc_stats().allocations, 2u);
+  EXPECT_EQ(st.alloc_stats().live_bytes * 2, st.alloc_stats().peak_bytes);
+
+  Set<int> other;
+  other.swap(s);
+  EXPECT_EQ(other.alloc_stats().allocations, 3u);
+  EXPECT_EQ(s.alloc_stats().allocations, 0u);
+  EXPECT_GE(stats::total().allocations, 7u);
+}
+
+TEST(AllocStatsTest, MultisetApartFromSet) {
+  stats::reset<Set<int>>();
+  stats::reset<Multiset<int>>();
+  Multiset<int> s({1, 1, 2});
+  Multiset<int> other({1, 3});
+  s.merge(other);  // Relinks the nodes of `other`.
+  if (!stats::kEnabled) {
+    EXPECT_EQ(stats::of<Multiset<int>>().allocations, 0u);
+    return;
+  }
+  EXPECT_EQ(stats::of<Set<int>>().allocations, 0u);
+  EXPECT_EQ(stats::of<Multiset<int>>().allocations, 5u);
+  EXPECT_EQ(stats::of<Multiset<int>>().deallocations, 0u);
+  EXPECT_EQ(s.alloc_stats().live_bytes * 3,
+            s.alloc_stats().bytes_allocated * 5);
+  EXPECT_EQ(other.alloc_stats().live_bytes, 0u);
+}
+
+TEST(ArrayTest, Alignment) {
+  s21::Array<float, 3, 32> a = {1.0f, 2.0f, 3.0f};
+  EXPECT_EQ(alignof(decltype(a)), 32u);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(a.data()) % 32, 0u);
+  EXPECT_EQ(a[2], 3.0f);
+}
+
 // Тестирование конструктора по умолчанию
 TEST(StackTest, DefaultConstructor) {
   s21::Stack<int> s;
@@ -558,6 +2178,219 @@ TEST(QueueTest, Swap) {
   EXPECT_EQ(q2.back(), 3);
 }
 
+// Тестирование массива фиксированного размера
+TEST(ArrayTest, AggregateInitialization) {
+  s21::Array<int, 4> a = {1, 2, 3, 4};
+  EXPECT_EQ(a.size(), 4);
+  EXPECT_FALSE(a.empty());
+  EXPECT_EQ(a.front(), 1);
+  EXPECT_EQ(a.back(), 4);
+  EXPECT_EQ(a.at(2), 3);
+  EXPECT_THROW(a.at(4), std::out_of_range);
+  EXPECT_EQ(a.data_ptr(), &a[0]);
+  EXPECT_EQ(sizeof(a), sizeof(int[4]));
+}
+
+TEST(ArrayTest, EmptyArray) {
+  s21::Array<int, 0> a = {};
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.begin(), a.end());
+  EXPECT_THROW(a.front(), std::out_of_range);
+  EXPECT_THROW(a.back(), std::out_of_range);
+}
+
+TEST(ArrayTest, FillSwapCompare) {
+  s21::Array<int, 3> a = {1, 2, 3};
+  s21::Array<int, 3> b = {};
+  b.fill(7);
+  EXPECT_EQ(b[0], 7);
+  EXPECT_EQ(b[2], 7);
+  EXPECT_TRUE(a < b);
+  a.swap(b);
+  EXPECT_EQ(a[1], 7);
+  EXPECT_EQ(b[1], 2);
+  EXPECT_TRUE(a != b);
+  b = a;
+  EXPECT_TRUE(a == b);
+  EXPECT_TRUE(a <= b && a >= b);
+}
+
+constexpr s21::Array<int, 3> MakeFilledArray(int value) {
+  s21::Array<int, 3> a = {};
+  a.fill(value);
+  a[1] = value + 1;
+  return a;
+}
+
+TEST(ArrayTest, Constexpr) {
+  constexpr s21::Array<int, 3> a = MakeFilledArray(4);
+  static_assert(a[0] == 4 && a[1] == 5 && a.back() == 4, "constexpr access");
+  static_assert(a.size() == 3 && !a.empty(), "constexpr capacity");
+  static_assert(a == MakeFilledArray(4) && a < MakeFilledArray(5),
+                "constexpr comparison");
+  EXPECT_EQ(a.at(1), 5);
+}
+
+// Тестирование SIMD-ядер на всех доступных уровнях
+class SimdTest : public ::testing::TestWithParam<s21::simd::Level> {
+ protected:
+  void SetUp() override { s21::simd::set_level(GetParam()); }
+  void TearDown() override {
+    s21::simd::set_level(s21::simd::detected_level());
+  }
+};
+
+TEST_P(SimdTest, IntKernelsMatchScalar) {
+  for (int n : {0, 1, 3, 4, 7, 8, 9, 31, 64, 1000}) {
+    s21::Vector<int> v;
+    for (int i = 0; i < n; ++i) v.push_back((i * 7919) % 113 - 50);
+    const int *first = v.data();
+    const int *last = first + n;
+    for (int needle : {-50, 0, 62, 1000}) {
+      EXPECT_EQ(s21::simd::find(first, last, needle),
+                s21::simd::scalar::find(first, last, needle));
+      EXPECT_EQ(s21::simd::count(first, last, needle),
+                s21::simd::scalar::count(first, last, needle));
+    }
+    EXPECT_EQ(s21::simd::min_element(first, last),
+              s21::simd::scalar::min_element(first, last));
+    EXPECT_EQ(s21::simd::max_element(first, last),
+              s21::simd::scalar::max_element(first, last));
+    EXPECT_EQ(s21::simd::accumulate(first, last, 5),
+              s21::simd::scalar::accumulate(first, last, 5));
+  }
+}
+
+TEST_P(SimdTest, FloatKernelsMatchScalar) {
+  for (int n : {0, 1, 5, 8, 17, 100}) {
+    s21::Vector<float> v;
+    for (int i = 0; i < n; ++i) v.push_back(static_cast<float>(i % 9) - 4.5f);
+    const float *first = v.data();
+    const float *last = first + n;
+    EXPECT_EQ(s21::simd::find(first, last, 3.5f),
+              s21::simd::scalar::find(first, last, 3.5f));
+    EXPECT_EQ(s21::simd::count(first, last, -4.5f),
+              s21::simd::scalar::count(first, last, -4.5f));
+    EXPECT_EQ(s21::simd::min_element(first, last),
+              s21::simd::scalar::min_element(first, last));
+    EXPECT_EQ(s21::simd::max_element(first, last),
+              s21::simd::scalar::max_element(first, last));
+    EXPECT_FLOAT_EQ(s21::simd::accumulate(first, last, 1.0f),
+                    s21::simd::scalar::accumulate(first, last, 1.0f));
+  }
+}
+
+TEST_P(SimdTest, NanExtremesStayInRange) {
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  const float one[] = {nan};
+  EXPECT_EQ(s21::simd::min_element(one, one + 1), one);
+  EXPECT_EQ(s21::simd::max_element(one, one + 1), one);
+  const float three[] = {nan, nan, nan};
+  EXPECT_EQ(s21::simd::max_element(three, three + 3), three);
+  s21::Vector<float> v(17);
+  s21::simd::fill(v, nan);
+  EXPECT_EQ(s21::simd::min_element(v), v.begin());
+  EXPECT_EQ(s21::simd::max_element(v), v.begin());
+}
+
+TEST_P(SimdTest, ContainerFrontEnds) {
+  s21::Vector<int> v(37);
+  s21::simd::fill(v, 3);
+  v[20] = -1;
+  v[30] = 9;
+  EXPECT_EQ(s21::simd::count(v, 3), 35);
+  EXPECT_EQ(*s21::simd::min_element(v), -1);
+  EXPECT_EQ(s21::simd::max_element(v), v.begin() + 30);
+  EXPECT_EQ(s21::simd::find(v, 9), v.begin() + 30);
+  EXPECT_EQ(s21::simd::find(v, 4), v.end());
+  EXPECT_EQ(s21::simd::accumulate(v, 0), 35 * 3 - 1 + 9);
+
+  s21::Array<float, 10> a = {};
+  s21::simd::fill(a, 2.0f);
+  a[7] = 0.5f;
+  EXPECT_EQ(s21::simd::min_element(a), a.data_ptr() + 7);
+  EXPECT_EQ(s21::simd::find(a, 0.5f), a.data_ptr() + 7);
+  EXPECT_EQ(s21::simd::count(a, 2.0f), 9);
+  EXPECT_FLOAT_EQ(s21::simd::accumulate(a, 0.0f), 18.5f);
+
+  s21::Array<double, 3> d = {1.0, 3.0, 2.0};
+  EXPECT_EQ(s21::simd::max_element(d), d.data_ptr() + 1);
+}
+
+INSTANTIATE_TEST_SUITE_P(AllLevels, SimdTest,
+                         ::testing::Values(s21::simd::Level::kScalar,
+                                           s21::simd::Level::kSse42,
+                                           s21::simd::Level::kAvx2));
+
+// Тестирование очереди с приоритетами
+TEST(IndexedPriorityQueueTest, PushPopOrder) {
+  s21::IndexedPriorityQueue<int> q({5, 1, 4, 2, 3});
+  EXPECT_EQ(q.size(), 5);
+  for (int expected = 1; expected <= 5; ++expected) {
+    EXPECT_EQ(q.top(), expected);
+    q.pop();
+  }
+  EXPECT_TRUE(q.empty());
+  EXPECT_THROW(q.top(), std::out_of_range);
+  EXPECT_THROW(q.pop(), std::out_of_range);
+}
+
+TEST(IndexedPriorityQueueTest, DecreaseIncreaseKey) {
+  s21::IndexedPriorityQueue<int> q;
+  auto a = q.push(10);
+  auto b = q.push(20);
+  auto c = q.push(30);
+  q.decrease_key(c, 5);
+  EXPECT_EQ(q.top_handle(), c);
+  q.increase_key(c, 25);
+  EXPECT_EQ(q.top_handle(), a);
+  q.increase_key(a, 40);
+  EXPECT_EQ(q.top_handle(), b);
+  EXPECT_EQ(q.get(a), 40);
+  EXPECT_THROW(q.decrease_key(b, 50), std::invalid_argument);
+  EXPECT_THROW(q.increase_key(b, 1), std::invalid_argument);
+}
+
+TEST(IndexedPriorityQueueTest, EraseAndHandleReuse) {
+  s21::IndexedPriorityQueue<int, std::greater<int>, 2> q;
+  auto a = q.push(1);
+  auto b = q.push(7);
+  auto c = q.push(3);
+  q.erase(b);
+  EXPECT_FALSE(q.contains(b));
+  EXPECT_THROW(q.erase(b), std::out_of_range);
+  EXPECT_EQ(q.top(), 3);
+  auto d = q.push(9);
+  EXPECT_EQ(d, b);
+  EXPECT_EQ(q.top_handle(), d);
+  q.update(a, 10);
+  EXPECT_EQ(q.top_handle(), a);
+  q.update(a, 0);
+  EXPECT_EQ(q.top_handle(), d);
+  EXPECT_TRUE(q.contains(c));
+  EXPECT_EQ(q.size(), 3);
+}
+
+TEST(IndexedPriorityQueueTest, MatchesSortedOrder) {
+  s21::IndexedPriorityQueue<int> q;
+  s21::Vector<std::size_t> handles;
+  for (int i = 0; i < 200; ++i) {
+    handles.push_back(q.push((i * 37) % 101));
+  }
+  for (std::size_t i = 0; i < handles.size(); i += 3) {
+    q.erase(handles[i]);
+  }
+  for (std::size_t i = 1; i < handles.size(); i += 3) {
+    q.update(handles[i], q.get(handles[i]) - 50);
+  }
+  int previous = q.top();
+  while (!q.empty()) {
+    EXPECT_LE(previous, q.top());
+    previous = q.top();
+    q.pop();
+  }
+}
+
 
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
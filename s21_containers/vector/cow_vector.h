@@ -0,0 +1,137 @@
+#ifndef COW_VECTOR_H
+#define COW_VECTOR_H
+#include <atomic>
+#include <initializer_list>
+#include <memory>
+
+#include "vector.h"
+
+namespace s21 {
+// Copy-on-write Vector: copies with an equal allocator share one
+// reference-counted buffer and are O(1); the first mutation through a
+// shared copy clones the elements into a buffer of its own. Copies and
+// moves into a vector whose allocator compares unequal clone at once, so
+// a buffer never outlives the memory resource it came from. The count is
+// atomic, so copies of one CowVector may be made, read and dropped from
+// several threads.
+//
+// Non-const element access (at, operator[], data, begin/end) and insert
+// unshare and mark the buffer unshareable: later copies are deep, so the
+// references and iterators they handed out can never alias another
+// vector. The buffer becomes shareable again once clear() or an
+// assignment invalidates them.
+template <class T, class Allocator = std::allocator<T>>
+class CowVector {
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = VectorIterator<T>;
+  using const_iterator = VectorConstIterator<T>;
+  using size_type = std::size_t;
+  using pointer = T *;
+  using vector_type = Vector<T, Allocator>;
+  // Move assignment only clones when the allocators neither propagate nor
+  // compare equal.
+  static constexpr bool kNothrowMove =
+      std::allocator_traits<
+          Allocator>::propagate_on_container_move_assignment::value ||
+      std::allocator_traits<Allocator>::is_always_equal::value;
+
+  CowVector();
+  explicit CowVector(const allocator_type &alloc);
+  CowVector(size_type n, const allocator_type &alloc = allocator_type());
+  CowVector(std::initializer_list<value_type> const &items,
+            const allocator_type &alloc = allocator_type());
+  explicit CowVector(vector_type &&items);
+  CowVector(const CowVector &v);
+  CowVector(CowVector &&v) noexcept;
+  ~CowVector();
+  CowVector &operator=(const CowVector &v);
+  CowVector &operator=(CowVector &&v) noexcept(kNothrowMove);
+  allocator_type get_allocator() const;
+
+  // Element access; the non-const overloads unshare.
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  const_reference front() const;
+  const_reference back() const;
+  T *data();
+  const T *data() const;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  size_type capacity() const;
+  void reserve(size_type size);
+  void shrink_to_fit();
+
+  void clear();
+  iterator insert(iterator pos, const_reference value);
+  void erase(iterator pos);
+  void push_back(const_reference value);
+  void pop_back();
+  void swap(CowVector &other) noexcept;
+
+  // Vectors sharing this buffer, this one included; 0 when none is held.
+  size_type use_count() const;
+
+ private:
+  struct Rep {
+    template <class... Args>
+    explicit Rep(Args &&...args)
+        : refs(1), items(std::forward<Args>(args)...) {}
+
+    std::atomic<size_type> refs;
+    bool shareable = true;
+    vector_type items;
+  };
+  using rep_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Rep>;
+  using rep_traits = std::allocator_traits<rep_allocator>;
+
+  // A copy of v drawing any buffer it must clone from alloc.
+  CowVector(const CowVector &v, const rep_allocator &alloc);
+  template <class... Args>
+  Rep *MakeRep(Args &&...args);
+  void Release();
+  // Whether `rep` came from an allocator equal to ours.
+  bool Allocates(const Rep *rep) const;
+  // The elements of a buffer this vector owns alone, cloned if shared.
+  vector_type &Own();
+  // Own() for access that hands out references into the buffer.
+  vector_type &Expose();
+  // Runs a mutation that may reallocate; a new buffer has no outstanding
+  // references and is shareable again.
+  template <class Fn>
+  void Update(Fn fn);
+  size_type IndexOf(iterator pos) const;
+
+  Rep *rep_;
+  rep_allocator alloc_;
+};
+
+template class CowVector<int>;
+template class CowVector<double>;
+template class CowVector<char>;
+template class CowVector<float>;
+
+namespace pmr {
+template <class T>
+using CowVector = s21::CowVector<T, PolymorphicAllocator<T>>;
+}  // namespace pmr
+}  // namespace s21
+
+#include "cow_vector.tpp"
+
+#endif  // COW_VECTOR_H
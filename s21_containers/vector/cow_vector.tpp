@@ -0,0 +1,340 @@
+#ifndef COW_VECTOR_TPP
+#define COW_VECTOR_TPP
+
+#include <stdexcept>
+#include <utility>
+
+#include "cow_vector.h"
+
+namespace s21 {
+template <class T, class A>
+CowVector<T, A>::CowVector() : CowVector(A()) {}
+
+template <class T, class A>
+CowVector<T, A>::CowVector(const allocator_type &alloc)
+    : rep_(nullptr), alloc_(alloc) {}
+
+template <class T, class A>
+CowVector<T, A>::CowVector(size_type n, const allocator_type &alloc)
+    : CowVector(alloc) {
+  if (n) rep_ = MakeRep(n, alloc);
+}
+
+template <class T, class A>
+CowVector<T, A>::CowVector(std::initializer_list<T> const &items,
+                           const allocator_type &alloc)
+    : CowVector(alloc) {
+  if (items.size()) rep_ = MakeRep(items, alloc);
+}
+
+template <class T, class A>
+CowVector<T, A>::CowVector(vector_type &&items)
+    : CowVector(items.get_allocator()) {
+  rep_ = MakeRep(std::move(items));
+}
+
+template <class T, class A>
+CowVector<T, A>::CowVector(const CowVector &v)
+    : CowVector(v,
+                rep_traits::select_on_container_copy_construction(v.alloc_)) {}
+
+template <class T, class A>
+CowVector<T, A>::CowVector(const CowVector &v, const rep_allocator &alloc)
+    : CowVector(A(alloc)) {
+  if (!v.rep_) return;
+  // A buffer lives as long as any vector sharing it, so it is only shared
+  // with vectors that could have allocated it themselves.
+  if (v.rep_->shareable && Allocates(v.rep_)) {
+    v.rep_->refs.fetch_add(1, std::memory_order_relaxed);
+    rep_ = v.rep_;
+  } else {
+    vector_type &items = Own();
+    items.reserve(v.size());
+    for (const auto &item : v.rep_->items) items.push_back(item);
+  }
+}
+
+template <class T, class A>
+CowVector<T, A>::CowVector(CowVector &&v) noexcept
+    : rep_(std::exchange(v.rep_, nullptr)), alloc_(std::move(v.alloc_)) {}
+
+template <class T, class A>
+CowVector<T, A>::~CowVector() {
+  Release();
+}
+
+template <class T, class A>
+CowVector<T, A> &CowVector<T, A>::operator=(const CowVector &v) {
+  if (rep_ != v.rep_) {
+    // Built with the allocator this vector ends up with; pmr allocators
+    // cannot be assigned, so only a propagating one is.
+    constexpr bool kPropagate =
+        rep_traits::propagate_on_container_copy_assignment::value;
+    CowVector copy(v, kPropagate ? v.alloc_ : alloc_);
+    std::swap(rep_, copy.rep_);
+    if constexpr (kPropagate) alloc_ = v.alloc_;
+  }
+  return *this;
+}
+
+template <class T, class A>
+CowVector<T, A> &CowVector<T, A>::operator=(CowVector &&v) noexcept(
+    kNothrowMove) {
+  if (this != &v) {
+    if constexpr (rep_traits::propagate_on_container_move_assignment::value) {
+      alloc_ = std::move(v.alloc_);
+    } else if (v.rep_ && !Allocates(v.rep_)) {
+      // The buffer must not outlive its own allocator's resource here.
+      CowVector copy(v, alloc_);
+      std::swap(rep_, copy.rep_);
+      v.Release();
+      return *this;
+    }
+    Release();
+    rep_ = std::exchange(v.rep_, nullptr);
+  }
+  return *this;
+}
+
+template <class T, class A>
+typename CowVector<T, A>::allocator_type CowVector<T, A>::get_allocator()
+    const {
+  return allocator_type(alloc_);
+}
+
+template <class T, class A>
+typename CowVector<T, A>::reference CowVector<T, A>::at(size_type pos) {
+  if (pos >= size()) {
+    throw std::out_of_range("Index out of range");
+  }
+  return Expose()[pos];
+}
+
+template <class T, class A>
+typename CowVector<T, A>::const_reference CowVector<T, A>::at(
+    size_type pos) const {
+  if (pos >= size()) {
+    throw std::out_of_range("Index out of range");
+  }
+  return rep_->items[pos];
+}
+
+template <class T, class A>
+typename CowVector<T, A>::reference CowVector<T, A>::operator[](
+    size_type pos) {
+  return Expose()[pos];
+}
+
+template <class T, class A>
+typename CowVector<T, A>::const_reference CowVector<T, A>::operator[](
+    size_type pos) const {
+  return rep_->items[pos];
+}
+
+template <class T, class A>
+typename CowVector<T, A>::const_reference CowVector<T, A>::front() const {
+  if (empty()) {
+    throw std::out_of_range("Vector is empty");
+  }
+  return rep_->items[0];
+}
+
+template <class T, class A>
+typename CowVector<T, A>::const_reference CowVector<T, A>::back() const {
+  if (empty()) {
+    throw std::out_of_range("Vector is empty");
+  }
+  return rep_->items[size() - 1];
+}
+
+template <class T, class A>
+T *CowVector<T, A>::data() {
+  return rep_ ? Expose().data() : nullptr;
+}
+
+template <class T, class A>
+const T *CowVector<T, A>::data() const {
+  return rep_ ? rep_->items.data() : nullptr;
+}
+
+template <class T, class A>
+typename CowVector<T, A>::iterator CowVector<T, A>::begin() {
+  return iterator(data());
+}
+
+template <class T, class A>
+typename CowVector<T, A>::iterator CowVector<T, A>::end() {
+  return iterator(data() + size());
+}
+
+template <class T, class A>
+typename CowVector<T, A>::const_iterator CowVector<T, A>::begin() const {
+  return const_iterator(const_cast<T *>(data()));
+}
+
+template <class T, class A>
+typename CowVector<T, A>::const_iterator CowVector<T, A>::end() const {
+  return const_iterator(const_cast<T *>(data()) + size());
+}
+
+template <class T, class A>
+bool CowVector<T, A>::empty() const {
+  return size() == 0;
+}
+
+template <class T, class A>
+typename CowVector<T, A>::size_type CowVector<T, A>::size() const {
+  return rep_ ? rep_->items.size() : 0;
+}
+
+template <class T, class A>
+typename CowVector<T, A>::size_type CowVector<T, A>::max_size() const {
+  return std::allocator_traits<A>::max_size(A(alloc_));
+}
+
+template <class T, class A>
+typename CowVector<T, A>::size_type CowVector<T, A>::capacity() const {
+  return rep_ ? rep_->items.capacity() : 0;
+}
+
+template <class T, class A>
+void CowVector<T, A>::reserve(size_type size) {
+  if (size > capacity()) {
+    Update([size](vector_type &items) { items.reserve(size); });
+  }
+}
+
+template <class T, class A>
+void CowVector<T, A>::shrink_to_fit() {
+  if (capacity() > size()) {
+    Update([](vector_type &items) { items.shrink_to_fit(); });
+  }
+}
+
+template <class T, class A>
+void CowVector<T, A>::clear() {
+  if (!rep_) return;
+  if (use_count() > 1) {
+    Release();
+  } else {
+    rep_->items.clear();
+    rep_->shareable = true;
+  }
+}
+
+template <class T, class A>
+typename CowVector<T, A>::iterator CowVector<T, A>::insert(
+    iterator pos, const_reference value) {
+  // The iterator returned points into the buffer, which must therefore
+  // stay unshared even when the insert reallocated it.
+  size_type index = IndexOf(pos);
+  vector_type &items = Expose();
+  return items.insert(items.begin() + index, value);
+}
+
+template <class T, class A>
+void CowVector<T, A>::erase(iterator pos) {
+  size_type index = IndexOf(pos);
+  vector_type &items = Own();
+  items.erase(items.begin() + index);
+}
+
+template <class T, class A>
+void CowVector<T, A>::push_back(const_reference value) {
+  Update([&value](vector_type &items) { items.push_back(value); });
+}
+
+template <class T, class A>
+void CowVector<T, A>::pop_back() {
+  if (!empty()) Own().pop_back();
+}
+
+template <class T, class A>
+void CowVector<T, A>::swap(CowVector &other) noexcept {
+  if constexpr (rep_traits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
+  std::swap(rep_, other.rep_);
+}
+
+template <class T, class A>
+typename CowVector<T, A>::size_type CowVector<T, A>::use_count() const {
+  return rep_ ? rep_->refs.load(std::memory_order_acquire) : 0;
+}
+
+template <class T, class A>
+template <class... Args>
+typename CowVector<T, A>::Rep *CowVector<T, A>::MakeRep(Args &&...args) {
+  Rep *rep = rep_traits::allocate(alloc_, 1);
+  try {
+    rep_traits::construct(alloc_, rep, std::forward<Args>(args)...);
+  } catch (...) {
+    rep_traits::deallocate(alloc_, rep, 1);
+    throw;
+  }
+  return rep;
+}
+
+template <class T, class A>
+void CowVector<T, A>::Release() {
+  Rep *rep = std::exchange(rep_, nullptr);
+  // acq_rel: the last owner sees every other owner's reads finished.
+  if (!rep || rep->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+    return;
+  }
+  rep_allocator alloc(rep->items.get_allocator());
+  rep_traits::destroy(alloc, rep);
+  rep_traits::deallocate(alloc, rep, 1);
+}
+
+template <class T, class A>
+typename CowVector<T, A>::vector_type &CowVector<T, A>::Own() {
+  if (!rep_) {
+    rep_ = MakeRep(allocator_type(alloc_));
+  } else if (use_count() > 1) {
+    Rep *copy = MakeRep(allocator_type(alloc_));
+    try {
+      copy->items.reserve(rep_->items.capacity());
+      for (const auto &item : rep_->items) copy->items.push_back(item);
+    } catch (...) {
+      Rep *shared = std::exchange(rep_, copy);
+      Release();
+      rep_ = shared;
+      throw;
+    }
+    Release();
+    rep_ = copy;
+  }
+  return rep_->items;
+}
+
+template <class T, class A>
+bool CowVector<T, A>::Allocates(const Rep *rep) const {
+  return rep_allocator(rep->items.get_allocator()) == alloc_;
+}
+
+template <class T, class A>
+typename CowVector<T, A>::vector_type &CowVector<T, A>::Expose() {
+  vector_type &items = Own();
+  rep_->shareable = false;
+  return items;
+}
+
+template <class T, class A>
+template <class Fn>
+void CowVector<T, A>::Update(Fn fn) {
+  vector_type &items = Own();
+  const T *before = items.data();
+  fn(items);
+  if (items.data() != before) rep_->shareable = true;
+}
+
+template <class T, class A>
+typename CowVector<T, A>::size_type CowVector<T, A>::IndexOf(
+    iterator pos) const {
+  const T *base = data();
+  return base ? static_cast<size_type>(pos.operator->() - base) : 0;
+}
+}  // namespace s21
+
+#endif  // COW_VECTOR_TPP
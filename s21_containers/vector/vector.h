@@ -1,6 +1,10 @@
 #ifndef VECTOR_H
 #define VECTOR_H
 #include <initializer_list>
+#include <memory>
+
+#include "../memory/alloc_stats.h"
+#include "../memory/memory_resource.h"
 
 namespace s21 {
 template <class T>
@@ -9,10 +13,11 @@ class VectorIterator;
 template <class T>
 class VectorConstIterator;
 
-template <class T>
-class Vector {
+template <class T, class Allocator = std::allocator<T>>
+class Vector : private stats::Tracker<Vector<T, Allocator>> {
  public:
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = value_type &;
   using const_reference = const value_type &;
   using iterator = VectorIterator<T>;
@@ -22,19 +27,25 @@ class Vector {
 
   // Vector Member functions
   Vector();
-  Vector(size_type n);
-  Vector(std::initializer_list<value_type> const &items);
+  explicit Vector(const allocator_type &alloc);
+  Vector(size_type n, const allocator_type &alloc = allocator_type());
+  Vector(std::initializer_list<value_type> const &items,
+         const allocator_type &alloc = allocator_type());
   Vector(const Vector &v);
   Vector(Vector &&v);
   ~Vector();
   Vector &operator=(Vector &&v);
+  allocator_type get_allocator() const;
+  using stats::Tracker<Vector>::alloc_stats;
 
   // Vector Element access
   reference at(size_type pos);
   reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
   const_reference front();
   const_reference back();
   T *data();
+  const T *data() const;
 
   // Vector Iterators
   iterator begin();
@@ -61,12 +72,16 @@ class Vector {
   void print_vector();
 
  private:
+  using traits = std::allocator_traits<Allocator>;
+
   size_type size_;
   size_type capacity_;
   value_type *container_;
+  allocator_type allocator_;
 
   void add_memory(size_type size, bool flag);
   size_type add_memory_size(size_type size, bool flag);
+  void release_memory();
 };
 
 template <class T>
@@ -130,7 +145,8 @@ class VectorIterator {
 
 template <class T>
 class VectorConstIterator {
-  friend class Vector<T>;
+  template <class, class>
+  friend class Vector;
   friend class VectorIterator<T>;
 
   using value_type = T;
@@ -183,6 +199,12 @@ template class Vector<double>;
 template class Vector<char>;
 template class Vector<float>;
 
+namespace pmr {
+template <class T>
+using Vector = s21::Vector<T, PolymorphicAllocator<T>>;
+}  // namespace pmr
 }  // namespace s21
 
+#include "vector.tpp"
+
 #endif  // VECTOR_H
@@ -0,0 +1,341 @@
+#ifndef VECTOR_TPP
+#define VECTOR_TPP
+
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+#include "vector.h"
+
+namespace s21 {
+template <class T, class A>
+Vector<T, A>::Vector() : Vector(A()) {}
+
+template <class T, class A>
+Vector<T, A>::Vector(const allocator_type &alloc)
+    : size_(0), capacity_(0), container_(nullptr), allocator_(alloc) {}
+
+template <class T, class A>
+Vector<T, A>::Vector(size_type n, const allocator_type &alloc)
+    : Vector(alloc) {
+  if (max_size() < n) {
+    throw std::out_of_range(
+        "Cannot create vector: size is larger than max_size");
+  }
+  if (n) {
+    add_memory(n, true);
+    for (; size_ < n; ++size_) {
+      traits::construct(allocator_, container_ + size_);
+    }
+  }
+}
+
+template <class T, class A>
+Vector<T, A>::Vector(std::initializer_list<T> const &items,
+                     const allocator_type &alloc)
+    : Vector(alloc) {
+  if (items.size()) {
+    add_memory(items.size(), true);
+    for (const auto &item : items) {
+      traits::construct(allocator_, container_ + size_, item);
+      ++size_;
+    }
+  }
+}
+
+template <class T, class A>
+Vector<T, A>::Vector(const Vector &v)
+    : Vector(traits::select_on_container_copy_construction(v.allocator_)) {
+  if (v.container_) {
+    add_memory(v.capacity_, true);
+    for (; size_ < v.size_; ++size_) {
+      traits::construct(allocator_, container_ + size_, v.container_[size_]);
+    }
+  }
+}
+
+template <class T, class A>
+Vector<T, A>::Vector(Vector &&v)
+    : size_(v.size_),
+      capacity_(v.capacity_),
+      container_(v.container_),
+      allocator_(std::move(v.allocator_)) {
+  v.size_ = 0;
+  v.capacity_ = 0;
+  v.container_ = nullptr;
+  this->TrackAdopt(v);
+}
+
+template <class T, class A>
+Vector<T, A>::~Vector() {
+  release_memory();
+}
+
+template <class T, class A>
+Vector<T, A> &Vector<T, A>::operator=(Vector &&v) {
+  if (this == &v) return *this;
+  if (traits::propagate_on_container_move_assignment::value ||
+      allocator_ == v.allocator_) {
+    release_memory();
+    if constexpr (traits::propagate_on_container_move_assignment::value) {
+      allocator_ = std::move(v.allocator_);
+    }
+    size_ = v.size_;
+    capacity_ = v.capacity_;
+    container_ = v.container_;
+
+    v.size_ = 0;
+    v.capacity_ = 0;
+    v.container_ = nullptr;
+    this->TrackAdopt(v);
+  } else {
+    // Storage cannot change hands between unequal allocators that stay put:
+    // move the elements into memory owned by our own allocator instead.
+    clear();
+    reserve(v.size_);
+    for (; size_ < v.size_; ++size_) {
+      traits::construct(allocator_, container_ + size_,
+                        std::move(v.container_[size_]));
+    }
+    v.clear();
+  }
+  return *this;
+}
+
+template <class T, class A>
+typename Vector<T, A>::allocator_type Vector<T, A>::get_allocator() const {
+  return allocator_;
+}
+
+template <class T, class A>
+typename Vector<T, A>::reference Vector<T, A>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("Index out of range");
+  }
+  return container_[pos];
+}
+
+template <class T, class A>
+typename Vector<T, A>::reference Vector<T, A>::operator[](size_type pos) {
+  return container_[pos];
+}
+
+template <class T, class A>
+typename Vector<T, A>::const_reference Vector<T, A>::operator[](
+    size_type pos) const {
+  return container_[pos];
+}
+
+template <class T, class A>
+typename Vector<T, A>::const_reference Vector<T, A>::front() {
+  if (this->empty()) {
+    throw std::out_of_range("Vector is empty");
+  }
+  return *container_;
+}
+
+template <class T, class A>
+typename Vector<T, A>::const_reference Vector<T, A>::back() {
+  if (this->empty()) {
+    throw std::out_of_range("Vector is empty");
+  }
+  return *(container_ + size_ - 1);
+}
+
+template <class T, class A>
+T *Vector<T, A>::data() {
+  return container_;
+}
+
+template <class T, class A>
+const T *Vector<T, A>::data() const {
+  return container_;
+}
+
+template <class T, class A>
+typename Vector<T, A>::iterator Vector<T, A>::begin() {
+  return iterator(container_);
+}
+
+template <class T, class A>
+typename Vector<T, A>::iterator Vector<T, A>::end() {
+  return iterator(container_ + size_);
+}
+
+template <class T, class A>
+typename Vector<T, A>::const_iterator Vector<T, A>::begin() const {
+  return iterator(container_);
+}
+
+template <class T, class A>
+typename Vector<T, A>::const_iterator Vector<T, A>::end() const {
+  return iterator(container_ + size_);
+}
+
+template <class T, class A>
+bool Vector<T, A>::empty() const {
+  return size_ == 0;
+}
+
+template <class T, class A>
+typename Vector<T, A>::size_type Vector<T, A>::size() const {
+  return size_;
+}
+
+template <class T, class A>
+typename Vector<T, A>::size_type Vector<T, A>::max_size() const {
+  return traits::max_size(allocator_);
+}
+
+template <class T, class A>
+void Vector<T, A>::reserve(size_type size) {
+  if (size >= max_size()) {
+    throw std::length_error("Size is larger that max size");
+  }
+  if (size > capacity_) {
+    this->add_memory(size, true);
+  }
+}
+
+template <class T, class A>
+void Vector<T, A>::shrink_to_fit() {
+  if (capacity_ > size_) {
+    if (size_) {
+      this->add_memory(size_, true);
+    } else {
+      release_memory();
+    }
+  }
+}
+
+template <class T, class A>
+void Vector<T, A>::add_memory(size_type size, bool flag) {
+  size_type capacity = this->add_memory_size(size, flag);
+  value_type *tmp = traits::allocate(allocator_, capacity);
+  this->TrackAllocate(capacity * sizeof(value_type));
+  for (size_type i = 0; i < this->size_; ++i) {
+    traits::construct(allocator_, tmp + i, std::move(container_[i]));
+    traits::destroy(allocator_, container_ + i);
+  }
+  if (container_) {
+    traits::deallocate(allocator_, container_, capacity_);
+    this->TrackDeallocate(capacity_ * sizeof(value_type));
+  }
+  container_ = tmp;
+  capacity_ = capacity;
+}
+
+template <class T, class A>
+typename Vector<T, A>::size_type Vector<T, A>::add_memory_size(size_type size,
+                                                               bool flag) {
+  size_type n = 2;
+  return flag ? size : n * (capacity_ > 0 ? capacity_ : n);
+}
+
+template <class T, class A>
+void Vector<T, A>::release_memory() {
+  clear();
+  if (container_) {
+    traits::deallocate(allocator_, container_, capacity_);
+    this->TrackDeallocate(capacity_ * sizeof(value_type));
+  }
+  container_ = nullptr;
+  capacity_ = 0;
+}
+
+template <class T, class A>
+typename Vector<T, A>::size_type Vector<T, A>::capacity() const {
+  return capacity_;
+}
+
+template <class T, class A>
+void Vector<T, A>::clear() {
+  for (size_type i = 0; i < size_; i++) {
+    traits::destroy(allocator_, container_ + i);
+  }
+  size_ = 0;
+}
+
+template <class T, class A>
+typename Vector<T, A>::iterator Vector<T, A>::insert(iterator pos,
+                                                     const_reference value) {
+  size_type cur_pos = &(*pos) - container_;
+
+  if (cur_pos > size_) {
+    throw std::out_of_range("Index out of range");
+  }
+  value_type copy(value);
+  if (size_ + 1 > capacity_) {
+    size_type new_capacity = (capacity_ == 0) ? 1 : capacity_ * 2;
+    add_memory(new_capacity, true);
+  }
+  if (cur_pos == size_) {
+    traits::construct(allocator_, container_ + size_, std::move(copy));
+  } else {
+    traits::construct(allocator_, container_ + size_,
+                      std::move(container_[size_ - 1]));
+    for (size_type i = size_ - 1; i > cur_pos; --i) {
+      container_[i] = std::move(container_[i - 1]);
+    }
+    container_[cur_pos] = std::move(copy);
+  }
+  size_++;
+  return iterator(container_ + cur_pos);
+}
+
+template <class T, class A>
+void Vector<T, A>::erase(iterator pos) {
+  size_type cur_pos = &(*pos) - container_;
+  if (cur_pos >= size_) {
+    throw std::out_of_range("Erase error: Index out of range");
+  }
+  for (size_type i = cur_pos; i + 1 < size_; i++) {
+    container_[i] = std::move(container_[i + 1]);
+  }
+  traits::destroy(allocator_, container_ + size_ - 1);
+  size_--;
+}
+
+template <class T, class A>
+void Vector<T, A>::push_back(const_reference value) {
+  if (size_ + 1 > capacity_) {
+    value_type copy(value);  // value may live in the buffer being replaced
+    size_type new_capacity = (capacity_ == 0) ? 1 : capacity_ * 2;
+    add_memory(new_capacity, true);
+    traits::construct(allocator_, container_ + size_, std::move(copy));
+  } else {
+    traits::construct(allocator_, container_ + size_, value);
+  }
+  size_++;
+}
+
+template <class T, class A>
+void Vector<T, A>::pop_back() {
+  if (size_ > 0) {
+    traits::destroy(allocator_, container_ + size_ - 1);
+    size_--;
+  }
+}
+
+template <class T, class A>
+void Vector<T, A>::swap(Vector &other) {
+  if constexpr (traits::propagate_on_container_swap::value) {
+    std::swap(other.allocator_, allocator_);
+  }
+  std::swap(other.size_, size_);
+  std::swap(other.capacity_, capacity_);
+  std::swap(other.container_, container_);
+  this->TrackSwap(other);
+}
+
+template <class T, class A>
+void Vector<T, A>::print_vector() {
+  for (size_type i = 0; i < size_; i++) {
+    std::cout << container_[i] << " ";
+  }
+  std::cout << std::endl;
+}
+
+}  // namespace s21
+
+#endif  // VECTOR_TPP